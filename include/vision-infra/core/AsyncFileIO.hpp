@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Backend used by AsyncFileIO
+ */
+enum class AsyncIOBackend {
+    AUTO,         // io_uring when the kernel allows it, otherwise THREAD_POOL
+    IO_URING,
+    THREAD_POOL
+};
+
+/**
+ * Async file I/O options
+ */
+struct AsyncIOOptions {
+    AsyncIOBackend backend = AsyncIOBackend::AUTO;
+    size_t queue_depth = 32;  // Requests in flight at once; later ones wait their turn
+};
+
+/**
+ * Asynchronous whole-file reads and writes, to keep many requests in flight
+ * against high-latency storage.
+ *
+ * The io_uring backend (Linux 5.6+) runs open, stat, read or write and close
+ * of every request as kernel operations, driven by a single completion
+ * thread. The thread-pool backend runs the same requests as blocking calls
+ * on queue_depth threads; it is used on other platforms and wherever
+ * io_uring is missing or disabled.
+ *
+ * Callbacks run on an engine thread and should hand heavy work elsewhere.
+ * The destructor waits for every submitted request to finish.
+ */
+class AsyncFileIO {
+public:
+    using ReadCallback = std::function<void(std::optional<std::vector<uint8_t>>)>;
+    using WriteCallback = std::function<void(bool)>;
+
+    /**
+     * Throws std::runtime_error if IO_URING is requested but unavailable
+     */
+    explicit AsyncFileIO(const AsyncIOOptions& options = {});
+    ~AsyncFileIO();
+
+    // Disable copy and move operations
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+    AsyncFileIO(AsyncFileIO&&) = delete;
+    AsyncFileIO& operator=(AsyncFileIO&&) = delete;
+
+    /**
+     * Backend actually in use (never AUTO)
+     */
+    AsyncIOBackend GetBackend() const noexcept;
+    size_t GetQueueDepth() const noexcept;
+
+    /**
+     * Read the whole file; std::nullopt if it cannot be opened or read
+     */
+    void ReadFile(const std::string& path, ReadCallback callback);
+    std::future<std::optional<std::vector<uint8_t>>> ReadFile(const std::string& path);
+
+    /**
+     * Create or truncate path and write data to it
+     */
+    void WriteFile(const std::string& path, std::vector<uint8_t> data, WriteCallback callback);
+    std::future<bool> WriteFile(const std::string& path, std::vector<uint8_t> data);
+
+    /**
+     * Whether this kernel and process allow the io_uring backend
+     */
+    static bool IsIoUringAvailable();
+
+    /**
+     * Process-wide engine with default options, created on first use
+     */
+    static std::shared_ptr<AsyncFileIO> GetDefault();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace core
+} // namespace vision_infra
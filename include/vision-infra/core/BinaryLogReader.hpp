@@ -0,0 +1,62 @@
+#pragma once
+
+#include "vision-infra/core/Logger.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * One decoded binary log record
+ */
+struct BinaryLogEntry {
+    LogLevel level{LogLevel::INFO};
+    std::chrono::system_clock::time_point time;
+    uint64_t thread_id{0};
+    std::string_view logger_name;
+    std::string_view format;
+    std::string message;  // format rendered with the recorded arguments
+};
+
+/**
+ * Decoder for files written by BinaryLogSink. A record cut short (for
+ * example by a crash) is treated as the end of the log.
+ */
+class BinaryLogReader {
+public:
+    /**
+     * Throws std::runtime_error if the file cannot be read or is not a binary log
+     */
+    explicit BinaryLogReader(const std::string& path);
+    ~BinaryLogReader();
+
+    BinaryLogReader(const BinaryLogReader&) = delete;
+    BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+    /**
+     * Decode the next record; returns false at the end of the log
+     */
+    bool Next(BinaryLogEntry& entry);
+
+    /**
+     * Text layout used by FormatEntry, with the same fields as
+     * Logger::SetPattern; source location fields are not recorded
+     */
+    void SetPattern(const std::string& pattern);
+
+    /**
+     * Append the entry rendered with the pattern (without a newline) to out
+     */
+    void FormatEntry(const BinaryLogEntry& entry, std::string& out) const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "vision-infra/core/Format.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace vision_infra {
+namespace core {
+
+enum class LogLevel;
+
+/**
+ * Argument encodings used in binary log records
+ */
+enum class BinaryArgType : uint8_t {
+    INT64 = 1,
+    UINT64,
+    DOUBLE,
+    BOOL,
+    CHAR,
+    STRING,   // uint32 length followed by the bytes
+    POINTER
+};
+
+/**
+ * Binary log settings
+ */
+struct BinaryLogOptions {
+    size_t initial_size{16 << 20};  // Initial mapping size; doubled whenever it fills up
+};
+
+namespace detail {
+
+template<typename T>
+void AppendRaw(std::string& out, const T& value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+template<typename T>
+void EncodeBinaryArg(std::string& out, const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        out.push_back(static_cast<char>(BinaryArgType::BOOL));
+        out.push_back(value ? 1 : 0);
+    } else if constexpr (std::is_same_v<T, char>) {
+        out.push_back(static_cast<char>(BinaryArgType::CHAR));
+        out.push_back(value);
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        out.push_back(static_cast<char>(BinaryArgType::INT64));
+        AppendRaw(out, static_cast<int64_t>(value));
+    } else if constexpr (std::is_integral_v<T>) {
+        out.push_back(static_cast<char>(BinaryArgType::UINT64));
+        AppendRaw(out, static_cast<uint64_t>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        out.push_back(static_cast<char>(BinaryArgType::DOUBLE));
+        AppendRaw(out, static_cast<double>(value));
+    } else if constexpr (std::is_enum_v<T>) {
+        EncodeBinaryArg(out, static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (StringLike<T>) {
+        std::string_view text(value);
+        out.push_back(static_cast<char>(BinaryArgType::STRING));
+        AppendRaw(out, static_cast<uint32_t>(text.size()));
+        out.append(text);
+    } else if constexpr (std::is_pointer_v<T>) {
+        out.push_back(static_cast<char>(BinaryArgType::POINTER));
+        AppendRaw(out, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+    } else {
+        // Types without a binary encoding are stored as their text form
+        ScopedFormatBuffer text;
+        FormatTo<T>(text.Get(), "{}", value);
+        EncodeBinaryArg(out, std::string_view(text.Get()));
+    }
+}
+
+} // namespace detail
+
+/**
+ * Compact binary log writer backed by a memory-mapped file.
+ *
+ * Each record stores the timestamp, level, thread id, logger id, format
+ * string id and the raw argument bytes; format strings and logger names are
+ * written once, the first time they are used. Nothing is formatted as text
+ * on the logging thread; BinaryLogReader (and the vision_infra_binlog_decode
+ * tool) turn the file back into regular log lines. Records use the host byte
+ * order. Thread-safe.
+ */
+class BinaryLogSink {
+public:
+    /**
+     * Create (truncating) path; throws std::runtime_error on failure
+     */
+    explicit BinaryLogSink(const std::string& path, const BinaryLogOptions& options = {});
+    ~BinaryLogSink();
+
+    // Disable copy and move operations
+    BinaryLogSink(const BinaryLogSink&) = delete;
+    BinaryLogSink& operator=(const BinaryLogSink&) = delete;
+    BinaryLogSink(BinaryLogSink&&) = delete;
+    BinaryLogSink& operator=(BinaryLogSink&&) = delete;
+
+    /**
+     * Id for a logger name, recorded in the file on first use
+     */
+    uint32_t RegisterLogger(std::string_view name);
+
+    /**
+     * Append a record; the format string must have static storage duration
+     * (string literals, as enforced by FormatString)
+     */
+    template<typename... Args>
+    void Write(LogLevel level, uint32_t logger_id, FormatString<Args...> format, const Args&... args);
+
+    /**
+     * Append a preformatted message
+     */
+    void WriteMessage(LogLevel level, uint32_t logger_id, std::string_view message);
+
+    /**
+     * Synchronize the mapped records with the file on disk
+     */
+    void Flush();
+
+    const std::string& GetPath() const noexcept;
+    uint64_t GetBytesWritten() const noexcept;
+
+private:
+    void WriteEvent(LogLevel level, uint32_t logger_id, std::string_view format, std::string_view payload,
+                    uint8_t arg_count);
+
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+template<typename... Args>
+void BinaryLogSink::Write(LogLevel level, uint32_t logger_id, FormatString<Args...> format, const Args&... args) {
+    static_assert(sizeof...(Args) <= 255, "too many log arguments");
+    detail::ScopedFormatBuffer payload;
+    (detail::EncodeBinaryArg(payload.Get(), args), ...);
+    WriteEvent(level, logger_id, format.Get(), payload.Get(), static_cast<uint8_t>(sizeof...(Args)));
+}
+
+} // namespace core
+} // namespace vision_infra
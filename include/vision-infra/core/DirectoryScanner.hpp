@@ -0,0 +1,103 @@
+#pragma once
+
+#include "vision-infra/core/FileSystem.hpp"
+#include "vision-infra/core/ThreadPool.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Directory scan options
+ */
+struct ScanOptions {
+    bool recursive = true;
+    bool follow_symlinks = false;       // Descend into symlinked directories (beware of cycles)
+    std::vector<MediaType> media_types;  // Only report these; empty reports every regular file
+};
+
+/**
+ * One file found by a scan
+ */
+struct ScanEntry {
+    std::string path;
+    MediaType media_type{MediaType::UNKNOWN};
+};
+
+class ScanStream;
+
+/**
+ * Recursive directory walker that filters by media type during the walk.
+ *
+ * Directories are handed out to workers one at a time, so a pool keeps every
+ * thread busy listing a different directory. Files are reported in no
+ * particular order; unreadable directories are skipped.
+ */
+class DirectoryScanner {
+public:
+    explicit DirectoryScanner(ScanOptions options = {});
+
+    /**
+     * Walk root on the calling thread, invoking callback for each matching
+     * file; returns the number of files reported
+     */
+    size_t Scan(const std::string& root, const std::function<void(const ScanEntry&)>& callback) const;
+
+    /**
+     * Walk root on the pool and the calling thread. callback runs
+     * concurrently on several threads. The first exception it throws stops
+     * the walk and is rethrown.
+     */
+    size_t Scan(const std::string& root, const std::function<void(const ScanEntry&)>& callback,
+                ThreadPool& pool) const;
+
+    /**
+     * Collect matching paths, sorted
+     */
+    std::vector<std::string> ScanAll(const std::string& root) const;
+    std::vector<std::string> ScanAll(const std::string& root, ThreadPool& pool) const;
+
+    /**
+     * Start a walk on the pool and consume its results as they are found.
+     * At most capacity entries are buffered; the walk waits for the consumer
+     * beyond that.
+     */
+    std::unique_ptr<ScanStream> Stream(const std::string& root, ThreadPool& pool, size_t capacity = 4096) const;
+
+    const ScanOptions& GetOptions() const noexcept;
+
+private:
+    ScanOptions options_;
+};
+
+/**
+ * Consumer end of DirectoryScanner::Stream. Destroying it before the end
+ * cancels the remaining walk.
+ */
+class ScanStream {
+public:
+    ~ScanStream();
+
+    ScanStream(const ScanStream&) = delete;
+    ScanStream& operator=(const ScanStream&) = delete;
+
+    /**
+     * Wait for the next entry; returns false once the walk finished and all
+     * entries were consumed. An exception from the walk is rethrown here.
+     */
+    bool Next(ScanEntry& entry);
+
+private:
+    friend class DirectoryScanner;
+    ScanStream();
+
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -1,9 +1,17 @@
 #pragma once
 
+#include "vision-infra/core/AsyncFileIO.hpp"
+#include "vision-infra/core/FileWriter.hpp"
+#include "vision-infra/core/MappedFile.hpp"
+#include "vision-infra/core/MediaType.hpp"
+#include <cstdint>
+#include <future>
 #include <string>
 #include <vector>
 #include <memory>
 #include <optional>
+#include <span>
+#include <string_view>
 
 namespace vision_infra {
 namespace core {
@@ -22,8 +30,39 @@ public:
     virtual bool CreateDirectories(const std::string& path) const = 0;
     virtual bool Remove(const std::string& path) const = 0;
     virtual bool RemoveAll(const std::string& path) const = 0;
+    
+    /**
+     * Whole file contents, byte for byte (binary mode)
+     */
     virtual std::optional<std::string> ReadFile(const std::string& path) const = 0;
+    
+    /**
+     * Replace the file with content, byte for byte (binary mode)
+     */
     virtual bool WriteFile(const std::string& path, const std::string& content) const = 0;
+    
+    /**
+     * Whole file as raw bytes. The default copies the result of ReadFile;
+     * FileSystem sizes the buffer once and fills it with a single read.
+     */
+    virtual std::optional<std::vector<uint8_t>> ReadBinaryFile(const std::string& path) const;
+    
+    /**
+     * Write raw bytes in one call; see FileWriteOptions for append and atomic
+     * replace. The default goes through ReadFile/WriteFile and honours append;
+     * whether the replace is atomic is up to WriteFile.
+     */
+    virtual bool WriteBinaryFile(const std::string& path, std::span<const uint8_t> data,
+                                 const FileWriteOptions& options = {}) const;
+    
+    /**
+     * Non-blocking variants of ReadBinaryFile and WriteBinaryFile. The
+     * defaults run synchronously and return a ready future; FileSystem uses
+     * AsyncFileIO.
+     */
+    virtual std::future<std::optional<std::vector<uint8_t>>> ReadFileAsync(const std::string& path) const;
+    virtual std::future<bool> WriteFileAsync(const std::string& path, std::vector<uint8_t> data) const;
+    
     virtual std::vector<std::string> ListFiles(const std::string& directory) const = 0;
     virtual std::vector<std::string> ListDirectories(const std::string& directory) const = 0;
     virtual std::optional<size_t> GetFileSize(const std::string& path) const = 0;
@@ -41,6 +80,11 @@ public:
 class FileSystem : public IFileSystem {
 public:
     FileSystem() = default;
+    
+    /**
+     * Run async requests on the given engine instead of AsyncFileIO::GetDefault()
+     */
+    explicit FileSystem(std::shared_ptr<AsyncFileIO> async_io);
     ~FileSystem() override = default;
     
     bool Exists(const std::string& path) const override;
@@ -51,7 +95,12 @@ public:
     bool Remove(const std::string& path) const override;
     bool RemoveAll(const std::string& path) const override;
     std::optional<std::string> ReadFile(const std::string& path) const override;
+    std::optional<std::vector<uint8_t>> ReadBinaryFile(const std::string& path) const override;
     bool WriteFile(const std::string& path, const std::string& content) const override;
+    bool WriteBinaryFile(const std::string& path, std::span<const uint8_t> data,
+                         const FileWriteOptions& options = {}) const override;
+    std::future<std::optional<std::vector<uint8_t>>> ReadFileAsync(const std::string& path) const override;
+    std::future<bool> WriteFileAsync(const std::string& path, std::vector<uint8_t> data) const override;
     std::vector<std::string> ListFiles(const std::string& directory) const override;
     std::vector<std::string> ListDirectories(const std::string& directory) const override;
     std::optional<size_t> GetFileSize(const std::string& path) const override;
@@ -61,6 +110,22 @@ public:
     std::string JoinPath(const std::string& left, const std::string& right) const override;
     std::string GetAbsolutePath(const std::string& path) const override;
     std::string GetCurrentWorkingDirectory() const override;
+    
+    /**
+     * Zero-copy read-only view of the file (see MappedFile)
+     */
+    std::optional<MappedFile> MapFile(const std::string& path,
+                                      MappedFile::AccessHint hint = MappedFile::AccessHint::NORMAL) const;
+    
+    /**
+     * Buffered streaming writer for output produced in chunks (see FileWriter)
+     */
+    std::optional<FileWriter> OpenWriter(const std::string& path, const FileWriteOptions& options = {}) const;
+    
+private:
+    AsyncFileIO& GetAsyncIO() const;
+    
+    std::shared_ptr<AsyncFileIO> async_io_;
 };
 
 /**
@@ -72,12 +137,18 @@ public:
     static void SetDefault(std::shared_ptr<IFileSystem> fs);
     
     // Convenience functions
-    static bool IsImageFile(const std::string& filename);
-    static bool IsVideoFile(const std::string& filename);
-    static bool IsModelFile(const std::string& filename);
-    static std::vector<std::string> GetSupportedImageExtensions();
-    static std::vector<std::string> GetSupportedVideoExtensions();
-    static std::vector<std::string> GetSupportedModelExtensions();
+    static bool IsImageFile(std::string_view filename);
+    static bool IsVideoFile(std::string_view filename);
+    static bool IsModelFile(std::string_view filename);
+    
+    /**
+     * Classify by extension (case-insensitive) without touching the file system
+     * or allocating; see ClassifyPath
+     */
+    static MediaType GetMediaType(std::string_view filename);
+    static std::span<const std::string_view> GetSupportedImageExtensions();
+    static std::span<const std::string_view> GetSupportedVideoExtensions();
+    static std::span<const std::string_view> GetSupportedModelExtensions();
     
 private:
     static std::shared_ptr<IFileSystem> default_file_system_;
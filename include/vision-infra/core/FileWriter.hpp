@@ -0,0 +1,95 @@
+#pragma once
+
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * File write options
+ */
+struct FileWriteOptions {
+    bool append = false;               // Append to an existing file instead of truncating
+    bool atomic = false;               // Write to a temporary file, then fsync and rename over path on Commit()
+    bool sync = false;                 // fsync before closing (always done for atomic writes)
+    size_t buffer_size = 1024 * 1024;  // User-space buffer; writes at least this large bypass it
+};
+
+/**
+ * Buffered binary file writer.
+ *
+ * Data is collected in a buffer of FileWriteOptions::buffer_size bytes and
+ * handed to the OS in large writes. With atomic set, everything goes to a
+ * temporary file next to the target that only replaces it once Commit()
+ * succeeds, so readers and crashes never see a partial file; destroying an
+ * uncommitted atomic writer discards the temporary file. Non-atomic writers
+ * are committed on destruction.
+ *
+ * Movable, not copyable; not thread-safe.
+ */
+class FileWriter {
+public:
+    FileWriter() noexcept = default;
+    ~FileWriter();
+
+    FileWriter(FileWriter&& other) noexcept;
+    FileWriter& operator=(FileWriter&& other) noexcept;
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+
+    /**
+     * Open path for writing; returns std::nullopt if it cannot be created or
+     * if append and atomic are both requested
+     */
+    static std::optional<FileWriter> Open(const std::string& path, const FileWriteOptions& options = {});
+
+    bool Write(std::span<const uint8_t> data);
+    bool Write(std::string_view data);
+
+    /**
+     * Hand buffered bytes to the OS (no fsync)
+     */
+    bool Flush();
+
+    /**
+     * Flush, sync if requested, close and (atomic mode) rename into place.
+     * Returns false if any write since Open failed; the writer is closed either way.
+     */
+    bool Commit();
+
+    /**
+     * Close without committing; an atomic writer removes its temporary file
+     */
+    void Abort() noexcept;
+
+    bool IsOpen() const noexcept { return file_ != nullptr; }
+    bool Good() const noexcept { return good_; }
+    uint64_t BytesWritten() const noexcept { return bytes_written_; }
+    const std::string& GetPath() const noexcept { return path_; }
+
+private:
+    bool WriteRaw(const uint8_t* data, size_t size);
+    void Reset() noexcept;
+
+    std::FILE* file_{nullptr};
+    std::string path_;
+    std::string temp_path_;  // Empty unless atomic
+    bool sync_{false};
+    bool good_{true};
+    uint64_t bytes_written_{0};
+    std::unique_ptr<uint8_t[]> buffer_;
+    size_t buffer_capacity_{0};
+    size_t buffer_used_{0};
+    MemoryCharge buffer_charge_;
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,326 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Lightweight std::format-style formatting used by the logging API.
+ *
+ * Replacement fields are "{}" or "{:spec}" with spec = [0][width][.precision][type],
+ * type one of d x X f e g s; "{{" and "}}" are literal braces. The format string is
+ * checked at compile time against the number of arguments, and output is appended
+ * to a caller-owned string so a reused buffer makes formatting allocation-free.
+ * Arithmetic, string, pointer and enum arguments are formatted natively; other
+ * types fall back to operator<<.
+ */
+namespace detail {
+
+struct FormatSpec {
+    bool zero_pad{false};
+    int width{0};
+    int precision{-1};
+    char type{'\0'};
+};
+
+// Not constexpr: reaching it during constant evaluation makes the format string ill-formed
+inline void FormatStringError(const char*) {}
+
+constexpr bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Parse the spec text after ':'; returns false when the spec is malformed
+constexpr bool ParseFormatSpec(std::string_view text, FormatSpec& spec) {
+    size_t pos = 0;
+    if (pos < text.size() && text[pos] == '0') {
+        spec.zero_pad = true;
+        ++pos;
+    }
+    while (pos < text.size() && IsDigit(text[pos])) {
+        spec.width = spec.width * 10 + (text[pos++] - '0');
+    }
+    if (pos < text.size() && text[pos] == '.') {
+        ++pos;
+        if (pos == text.size() || !IsDigit(text[pos])) {
+            return false;
+        }
+        spec.precision = 0;
+        while (pos < text.size() && IsDigit(text[pos])) {
+            spec.precision = spec.precision * 10 + (text[pos++] - '0');
+        }
+    }
+    if (pos < text.size()) {
+        constexpr std::string_view kTypes = "dxXfegs";
+        if (kTypes.find(text[pos]) == std::string_view::npos) {
+            return false;
+        }
+        spec.type = text[pos++];
+    }
+    return pos == text.size();
+}
+
+// Count replacement fields, reporting malformed format strings
+constexpr size_t CheckFormatString(std::string_view format, size_t arg_count) {
+    size_t fields = 0;
+    for (size_t pos = 0; pos < format.size(); ++pos) {
+        if (format[pos] == '{') {
+            if (pos + 1 < format.size() && format[pos + 1] == '{') {
+                ++pos;
+                continue;
+            }
+            size_t close = format.find('}', pos);
+            if (close == std::string_view::npos) {
+                FormatStringError("unterminated replacement field");
+                return fields;
+            }
+            std::string_view field = format.substr(pos + 1, close - pos - 1);
+            FormatSpec spec;
+            if (!field.empty() && (field[0] != ':' || !ParseFormatSpec(field.substr(1), spec))) {
+                FormatStringError("invalid replacement field");
+            }
+            ++fields;
+            pos = close;
+        } else if (format[pos] == '}') {
+            if (pos + 1 < format.size() && format[pos + 1] == '}') {
+                ++pos;
+                continue;
+            }
+            FormatStringError("unmatched '}' in format string");
+        }
+    }
+    if (fields != arg_count) {
+        FormatStringError("argument count does not match the format string");
+    }
+    return fields;
+}
+
+template<typename T>
+concept StringLike = std::convertible_to<const T&, std::string_view>;
+
+template<typename T>
+concept Streamable = requires(std::ostream& os, const T& value) { os << value; };
+
+inline void Pad(std::string& out, size_t start, const FormatSpec& spec, bool numeric) {
+    size_t length = out.size() - start;
+    if (spec.width <= 0 || length >= static_cast<size_t>(spec.width)) {
+        return;
+    }
+    size_t padding = static_cast<size_t>(spec.width) - length;
+    if (!numeric) {
+        out.append(padding, ' ');
+    } else if (spec.zero_pad) {
+        size_t sign = (length > 0 && out[start] == '-') ? 1 : 0;
+        out.insert(start + sign, padding, '0');
+    } else {
+        out.insert(start, padding, ' ');
+    }
+}
+
+template<typename T>
+void AppendValue(std::string& out, const T& value, const FormatSpec& spec) {
+    const size_t start = out.size();
+    std::array<char, 128> buffer{};
+    char* first = buffer.data();
+    char* last = buffer.data() + buffer.size();
+
+    if constexpr (std::is_same_v<T, bool>) {
+        out.append(value ? "true" : "false");
+    } else if constexpr (std::is_same_v<T, char>) {
+        out.push_back(value);
+    } else if constexpr (std::is_integral_v<T>) {
+        int base = (spec.type == 'x' || spec.type == 'X') ? 16 : 10;
+        auto result = std::to_chars(first, last, value, base);
+        if (spec.type == 'X') {
+            for (char* c = first; c != result.ptr; ++c) {
+                if (*c >= 'a' && *c <= 'f') *c = static_cast<char>(*c - 'a' + 'A');
+            }
+        }
+        out.append(first, result.ptr);
+        Pad(out, start, spec, true);
+        return;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        std::to_chars_result result{};
+        if (spec.type == 'e') {
+            result = spec.precision >= 0 ? std::to_chars(first, last, value, std::chars_format::scientific, spec.precision)
+                                         : std::to_chars(first, last, value, std::chars_format::scientific);
+        } else if (spec.type == 'g') {
+            result = spec.precision >= 0 ? std::to_chars(first, last, value, std::chars_format::general, spec.precision)
+                                         : std::to_chars(first, last, value, std::chars_format::general);
+        } else if (spec.type == 'f' || spec.precision >= 0) {
+            result = std::to_chars(first, last, value, std::chars_format::fixed,
+                                   spec.precision >= 0 ? spec.precision : 6);
+        } else {
+            result = std::to_chars(first, last, value);
+        }
+        out.append(first, result.ptr);
+        Pad(out, start, spec, true);
+        return;
+    } else if constexpr (std::is_enum_v<T>) {
+        AppendValue(out, static_cast<std::underlying_type_t<T>>(value), spec);
+        return;
+    } else if constexpr (StringLike<T>) {
+        std::string_view text(value);
+        if (spec.precision >= 0 && text.size() > static_cast<size_t>(spec.precision)) {
+            text = text.substr(0, static_cast<size_t>(spec.precision));
+        }
+        out.append(text);
+    } else if constexpr (std::is_pointer_v<T>) {
+        auto result = std::to_chars(first, last, reinterpret_cast<uintptr_t>(value), 16);
+        out.append("0x");
+        out.append(first, result.ptr);
+    } else if constexpr (Streamable<T>) {
+        std::ostringstream stream;
+        stream << value;
+        out.append(stream.str());
+    } else {
+        static_assert(Streamable<T>, "type cannot be formatted: provide operator<<");
+    }
+    Pad(out, start, spec, false);
+}
+
+// Type-erased argument reference, so the format loop is not instantiated per argument pack
+struct FormatArg {
+    const void* value;
+    void (*append)(std::string&, const void*, const FormatSpec&);
+};
+
+template<typename T>
+FormatArg MakeFormatArg(const T& value) {
+    return {&value, [](std::string& out, const void* ptr, const FormatSpec& spec) {
+                AppendValue(out, *static_cast<const T*>(ptr), spec);
+            }};
+}
+
+inline void VFormatTo(std::string& out, std::string_view format, const FormatArg* args, size_t arg_count) {
+    size_t next_arg = 0;
+    size_t literal_start = 0;
+    for (size_t pos = 0; pos < format.size(); ++pos) {
+        char c = format[pos];
+        if (c != '{' && c != '}') {
+            continue;
+        }
+        out.append(format.substr(literal_start, pos - literal_start));
+        if (pos + 1 < format.size() && format[pos + 1] == c) {
+            out.push_back(c);
+            literal_start = ++pos + 1;
+            continue;
+        }
+        size_t close = format.find('}', pos);
+        if (c == '}' || close == std::string_view::npos) {
+            literal_start = pos;
+            break;
+        }
+        FormatSpec spec;
+        std::string_view field = format.substr(pos + 1, close - pos - 1);
+        if (!field.empty() && field[0] == ':') {
+            ParseFormatSpec(field.substr(1), spec);
+        }
+        if (next_arg < arg_count) {
+            args[next_arg].append(out, args[next_arg].value, spec);
+            ++next_arg;
+        }
+        pos = close;
+        literal_start = close + 1;
+    }
+    if (literal_start < format.size()) {
+        out.append(format.substr(literal_start));
+    }
+}
+
+/**
+ * Per-thread scratch buffer for a formatted log message, cleared on entry.
+ * Buffers are kept per nesting depth, so an operator<< that logs while its
+ * own message is being formatted gets a buffer of its own instead of
+ * clobbering the outer one.
+ */
+class ScopedFormatBuffer {
+public:
+    ScopedFormatBuffer() : buffer_(Acquire()) {}
+    ~ScopedFormatBuffer() { --Depth(); }
+
+    // Disable copy and move operations
+    ScopedFormatBuffer(const ScopedFormatBuffer&) = delete;
+    ScopedFormatBuffer& operator=(const ScopedFormatBuffer&) = delete;
+    ScopedFormatBuffer(ScopedFormatBuffer&&) = delete;
+    ScopedFormatBuffer& operator=(ScopedFormatBuffer&&) = delete;
+
+    std::string& Get() noexcept { return buffer_; }
+
+private:
+    static size_t& Depth() noexcept {
+        thread_local size_t depth = 0;
+        return depth;
+    }
+
+    static std::string& Acquire() {
+        thread_local std::deque<std::string> buffers;  // Grows without moving existing buffers
+        size_t& depth = Depth();
+        if (depth == buffers.size()) {
+            buffers.emplace_back();
+        }
+        std::string& buffer = buffers[depth++];
+        buffer.clear();
+        return buffer;
+    }
+
+    std::string& buffer_;
+};
+
+} // namespace detail
+
+/**
+ * Format string checked at compile time against the number of arguments
+ */
+template<typename... Args>
+class BasicFormatString {
+public:
+    template<typename S>
+        requires std::convertible_to<const S&, std::string_view>
+    consteval BasicFormatString(const S& format) : format_(format) {
+        detail::CheckFormatString(format_, sizeof...(Args));
+    }
+
+    constexpr std::string_view Get() const noexcept { return format_; }
+
+private:
+    std::string_view format_;
+};
+
+template<typename... Args>
+using FormatString = BasicFormatString<std::type_identity_t<Args>...>;
+
+/**
+ * Append the formatted text to out
+ */
+template<typename... Args>
+void FormatTo(std::string& out, FormatString<Args...> format, const Args&... args) {
+    if constexpr (sizeof...(Args) == 0) {
+        detail::VFormatTo(out, format.Get(), nullptr, 0);
+    } else {
+        const std::array<detail::FormatArg, sizeof...(Args)> erased{detail::MakeFormatArg(args)...};
+        detail::VFormatTo(out, format.Get(), erased.data(), erased.size());
+    }
+}
+
+template<typename... Args>
+std::string Format(FormatString<Args...> format, const Args&... args) {
+    std::string out;
+    FormatTo<Args...>(out, format, args...);
+    return out;
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Summary of a LatencyHistogram, in milliseconds
+ */
+struct LatencyStats {
+    uint64_t count{0};
+    double min_ms{0.0};
+    double max_ms{0.0};
+    double mean_ms{0.0};
+    double p50_ms{0.0};
+    double p90_ms{0.0};
+    double p99_ms{0.0};
+    double p999_ms{0.0};
+};
+
+/**
+ * Fixed-size log-linear histogram of latencies in nanoseconds.
+ *
+ * Values below 32 ns are exact; above, every power of two is split into 32
+ * buckets, so percentiles are accurate to within 1/64 (about 1.6%). Values
+ * of 2^40 ns (about 18 minutes) and more share the top bucket; min, max and
+ * mean stay exact. The histogram takes about 9 KiB and never allocates.
+ *
+ * Record() is lock-free and may be called from any number of threads; for
+ * the cheapest recording keep one histogram per thread or stream and
+ * Merge() them when reading. Reads concurrent with Record() may miss the
+ * values being recorded.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+    static constexpr unsigned kMaxExponent = 40;
+    static constexpr size_t kBucketCount = kSubBuckets + (kMaxExponent - kSubBucketBits) * kSubBuckets;
+
+    LatencyHistogram() noexcept = default;
+
+    // Copies are snapshots of the source's counters
+    LatencyHistogram(const LatencyHistogram& other) noexcept;
+    LatencyHistogram& operator=(const LatencyHistogram& other) noexcept;
+
+    /**
+     * Record one latency; negative values count as zero
+     */
+    void Record(std::chrono::nanoseconds latency) noexcept;
+    void RecordMs(double milliseconds) noexcept;
+
+    /**
+     * Add every value recorded in other
+     */
+    void Merge(const LatencyHistogram& other) noexcept;
+    void Reset() noexcept;
+
+    uint64_t GetCount() const noexcept;
+    double GetMinMs() const noexcept;
+    double GetMaxMs() const noexcept;
+    double GetMeanMs() const noexcept;
+
+    /**
+     * Latency below which percentile percent of the values fall, with
+     * percentile in [0, 100]; 0 if nothing was recorded
+     */
+    double GetPercentileMs(double percentile) const noexcept;
+
+    LatencyStats GetStats() const noexcept;
+
+    /**
+     * Compact binary form for shipping to a metrics backend: a version byte,
+     * the bucket layout, then varint-encoded min, max, sum and the non-empty
+     * buckets. A few dozen bytes for a typical frame-latency distribution.
+     */
+    std::vector<uint8_t> Serialize() const;
+
+    /**
+     * Parse Serialize() output; nullopt if data is malformed or uses another
+     * bucket layout
+     */
+    static std::optional<LatencyHistogram> Deserialize(std::span<const uint8_t> data);
+
+private:
+    uint64_t PercentileNs(double percentile, uint64_t count) const noexcept;
+
+    std::array<std::atomic<uint64_t>, kBucketCount> counts_{};
+    std::atomic<uint64_t> total_ns_{0};
+    std::atomic<uint64_t> min_ns_{UINT64_MAX};
+    std::atomic<uint64_t> max_ns_{0};
+};
+
+} // namespace core
+} // namespace vision_infra
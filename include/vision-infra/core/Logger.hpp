@@ -1,8 +1,29 @@
 #pragma once
 
+#include "vision-infra/core/BinaryLogSink.hpp"
+#include "vision-infra/core/Format.hpp"
 #include <string>
+#include <chrono>
 #include <memory>
 #include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <utility>
+
+// Numeric log levels for VISION_INFRA_LOG_MIN_LEVEL (match LogLevel)
+#define VISION_INFRA_LOG_LEVEL_TRACE 0
+#define VISION_INFRA_LOG_LEVEL_DEBUG 1
+#define VISION_INFRA_LOG_LEVEL_INFO 2
+#define VISION_INFRA_LOG_LEVEL_WARN 3
+#define VISION_INFRA_LOG_LEVEL_ERROR 4
+#define VISION_INFRA_LOG_LEVEL_FATAL 5
+
+// LOG_* macros below this level compile to nothing
+#ifndef VISION_INFRA_LOG_MIN_LEVEL
+#define VISION_INFRA_LOG_MIN_LEVEL VISION_INFRA_LOG_LEVEL_TRACE
+#endif
 
 namespace vision_infra {
 namespace core {
@@ -16,6 +37,35 @@ enum class LogLevel {
     FATAL
 };
 
+/**
+ * What an asynchronous logger does when its queue is full
+ */
+enum class OverflowPolicy {
+    BLOCK,        // Wait for the writer thread to make room
+    DROP_NEWEST,  // Discard the record being logged
+    DROP_OLDEST   // Discard the oldest queued record
+};
+
+/**
+ * Asynchronous logging settings
+ */
+struct AsyncOptions {
+    size_t queue_capacity{8192};
+    OverflowPolicy overflow_policy{OverflowPolicy::BLOCK};
+};
+
+/**
+ * Log file buffering and rotation settings (see RotatingFileSink)
+ */
+struct FileSinkOptions {
+    size_t buffer_size{1 << 20};                          // Bytes buffered before writing
+    std::chrono::milliseconds flush_interval{1000};       // Max age of buffered lines
+    LogLevel flush_level{LogLevel::WARN};                 // Lines at or above are written immediately
+    uint64_t max_file_size{0};                            // Rotate beyond this size; 0 disables
+    std::chrono::seconds rotation_interval{0};            // Rotate after this long; 0 disables
+    size_t max_files{5};                                  // Rotated files kept besides the current one
+};
+
 /**
  * Interface for logging implementations
  */
@@ -27,6 +77,25 @@ public:
     virtual void SetLevel(LogLevel level) = 0;
     virtual LogLevel GetLevel() const = 0;
     virtual void Flush() = 0;
+    
+    /**
+     * Log with the call site attached; implementations without source
+     * location support fall back to Log()
+     */
+    virtual void LogAt(LogLevel level, const std::string& message, const std::source_location& location) {
+        (void)location;
+        Log(level, message);
+    }
+    
+    /**
+     * Binary log that formatted calls, including the LOG_* macros, write
+     * their format string and raw arguments to instead of rendering text;
+     * nullptr for text-only loggers
+     */
+    virtual BinaryLogSink* GetBinarySink() const noexcept { return nullptr; }
+    virtual uint32_t GetBinaryLoggerId() const noexcept { return 0; }
+    
+    bool IsEnabled(LogLevel level) const { return level >= GetLevel(); }
 };
 
 /**
@@ -35,19 +104,55 @@ public:
 class Logger : public ILogger {
 public:
     explicit Logger(const std::string& name = "");
-    ~Logger() override = default;
+    ~Logger() override;
     
     void Log(LogLevel level, const std::string& message) override;
+    void LogAt(LogLevel level, const std::string& message, const std::source_location& location) override;
     void SetLevel(LogLevel level) override;
     LogLevel GetLevel() const override;
     void Flush() override;
     
     // Configuration
-    void SetOutputFile(const std::string& filename);
+    /**
+     * Write to filename through a buffered RotatingFileSink; an empty name
+     * disables file output. Buffered lines reach the disk within
+     * options.flush_interval even if the logger goes quiet: the async writer
+     * flushes them when idle, a synchronous logger starts a timer thread.
+     * Throws std::runtime_error if the file cannot be opened.
+     */
+    void SetOutputFile(const std::string& filename, const FileSinkOptions& options = {});
     void EnableConsoleOutput(bool enable = true);
     void EnableTimestamp(bool enable = true);
+    
+    /**
+     * Set the line layout; the pattern is compiled once here. Fields:
+     * {timestamp} {ms} {us} {level} {name} {message} {thread}
+     * {source} {file} {line} {function}
+     */
     void SetPattern(const std::string& pattern);
     
+    /**
+     * Asynchronous mode: Log() pushes records into a bounded lock-free queue and
+     * a background thread formats and writes them. Switch modes during setup or
+     * shutdown, not while other threads are logging through this logger.
+     * Flush() waits until every record logged before the call has been
+     * written; records other threads log meanwhile do not hold it up.
+     */
+    void EnableAsync(const AsyncOptions& options = {});
+    void DisableAsync();
+    bool IsAsync() const;
+    uint64_t GetDroppedCount() const;
+    
+    /**
+     * Write records to a binary log instead of the text outputs; formatted
+     * calls then store the raw arguments without rendering any text. The sink
+     * may be shared between loggers; nullptr restores text output. Configure
+     * during setup, like EnableAsync.
+     */
+    void SetBinaryOutput(std::shared_ptr<BinaryLogSink> sink);
+    BinaryLogSink* GetBinarySink() const noexcept override;
+    uint32_t GetBinaryLoggerId() const noexcept override;
+    
     // Convenience methods
     void Trace(const std::string& message);
     void Debug(const std::string& message);
@@ -56,49 +161,190 @@ public:
     void Error(const std::string& message);
     void Fatal(const std::string& message);
     
-    // Template methods for formatted logging
+    /**
+     * Formatted logging, e.g. Info("{} score={:.2f}", label, score). The format
+     * string is checked at compile time and the message is rendered into a
+     * per-thread buffer only when the level is enabled.
+     */
     template<typename... Args>
-    void Trace(const std::string& format, Args&&... args);
+    void Trace(FormatString<Args...> format, Args&&... args);
     
     template<typename... Args>
-    void Debug(const std::string& format, Args&&... args);
+    void Debug(FormatString<Args...> format, Args&&... args);
     
     template<typename... Args>
-    void Info(const std::string& format, Args&&... args);
+    void Info(FormatString<Args...> format, Args&&... args);
     
     template<typename... Args>
-    void Warn(const std::string& format, Args&&... args);
+    void Warn(FormatString<Args...> format, Args&&... args);
     
     template<typename... Args>
-    void Error(const std::string& format, Args&&... args);
+    void Error(FormatString<Args...> format, Args&&... args);
     
     template<typename... Args>
-    void Fatal(const std::string& format, Args&&... args);
+    void Fatal(FormatString<Args...> format, Args&&... args);
     
 private:
+    template<typename... Args>
+    void LogFormatted(LogLevel level, FormatString<Args...> format, Args&&... args);
+    
     class Impl;
     std::unique_ptr<Impl> pImpl_;
 };
 
+template<typename... Args>
+void Logger::LogFormatted(LogLevel level, FormatString<Args...> format, Args&&... args) {
+    if (!IsEnabled(level)) {
+        return;
+    }
+    if (auto* binary = GetBinarySink()) {
+        binary->Write<Args...>(level, GetBinaryLoggerId(), format, args...);
+        return;
+    }
+    detail::ScopedFormatBuffer buffer;
+    FormatTo<Args...>(buffer.Get(), format, args...);
+    Log(level, buffer.Get());
+}
+
+template<typename... Args>
+void Logger::Trace(FormatString<Args...> format, Args&&... args) {
+    LogFormatted<Args...>(LogLevel::TRACE, format, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+void Logger::Debug(FormatString<Args...> format, Args&&... args) {
+    LogFormatted<Args...>(LogLevel::DEBUG, format, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+void Logger::Info(FormatString<Args...> format, Args&&... args) {
+    LogFormatted<Args...>(LogLevel::INFO, format, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+void Logger::Warn(FormatString<Args...> format, Args&&... args) {
+    LogFormatted<Args...>(LogLevel::WARN, format, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+void Logger::Error(FormatString<Args...> format, Args&&... args) {
+    LogFormatted<Args...>(LogLevel::ERROR, format, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+void Logger::Fatal(FormatString<Args...> format, Args&&... args) {
+    LogFormatted<Args...>(LogLevel::FATAL, format, std::forward<Args>(args)...);
+}
+
 /**
- * Global logger management
+ * Cheap, copyable reference to a registered logger, meant to be kept in a
+ * static at call sites. Registered loggers are never destroyed before exit
+ * (a replaced default logger is retired, not freed), so a handle stays
+ * valid; it keeps referring to the logger that was registered under its
+ * name when the handle was created.
+ */
+class LoggerHandle {
+public:
+    explicit LoggerHandle(ILogger& logger) noexcept : logger_(&logger) {}
+    
+    ILogger& Get() const noexcept { return *logger_; }
+    ILogger& operator*() const noexcept { return *logger_; }
+    ILogger* operator->() const noexcept { return logger_; }
+    operator ILogger&() const noexcept { return *logger_; }
+    
+private:
+    ILogger* logger_;
+};
+
+/**
+ * Global logger management. Looking up an existing logger does not take the
+ * registry mutex, but copies a shared_ptr out of an atomic<shared_ptr>, which
+ * may lock internally; only GetDefaultLoggerRef and LoggerHandle::Get are
+ * lock-free. Creating or replacing loggers takes the registry mutex.
  */
 class LoggerManager {
 public:
     static std::shared_ptr<ILogger> GetLogger(const std::string& name = "default");
+    
+    /**
+     * Like GetLogger, without touching the logger's reference count
+     */
+    static LoggerHandle GetHandle(std::string_view name = "default");
+    
+    /**
+     * Lock-free access to the default logger, used by the LOG_* macros.
+     * Loggers replaced through SetDefaultLogger stay alive until exit, so the
+     * reference remains valid.
+     */
+    static ILogger& GetDefaultLoggerRef() noexcept;
+    
+    /**
+     * Replace the default logger; nullptr installs a fresh default Logger.
+     * The replaced logger is flushed and, if it is a Logger, its file is
+     * closed; its async worker and binary sink keep running for threads
+     * still logging through a stale reference. Replaced loggers are kept
+     * until exit, one per call, so this is meant for setup and tests rather
+     * than per-frame use.
+     */
     static void SetDefaultLogger(std::shared_ptr<ILogger> logger);
     static void SetGlobalLevel(LogLevel level);
+    
+    /**
+     * Switch the default logger, all registered loggers and loggers created
+     * later to (or from) asynchronous mode
+     */
+    static void EnableAsync(const AsyncOptions& options = {});
+    static void DisableAsync();
     static LogLevel ParseLogLevel(const std::string& level);
     static std::string LogLevelToString(LogLevel level);
 };
 
-// Convenience macros
-#define LOG_TRACE(msg) vision_infra::core::LoggerManager::GetLogger()->Trace(msg)
-#define LOG_DEBUG(msg) vision_infra::core::LoggerManager::GetLogger()->Debug(msg)
-#define LOG_INFO(msg) vision_infra::core::LoggerManager::GetLogger()->Info(msg)
-#define LOG_WARN(msg) vision_infra::core::LoggerManager::GetLogger()->Warn(msg)
-#define LOG_ERROR(msg) vision_infra::core::LoggerManager::GetLogger()->Error(msg)
-#define LOG_FATAL(msg) vision_infra::core::LoggerManager::GetLogger()->Fatal(msg)
+namespace detail {
+
+inline void LogMessage(ILogger& logger, LogLevel level, const std::source_location& location,
+                       const std::string& message) {
+    logger.LogAt(level, message, location);
+}
+
+template<typename... Args>
+    requires(sizeof...(Args) > 0)
+void LogMessage(ILogger& logger, LogLevel level, const std::source_location& location,
+                FormatString<Args...> format, Args&&... args) {
+    if (auto* binary = logger.GetBinarySink()) {
+        binary->Write<Args...>(level, logger.GetBinaryLoggerId(), format, args...);
+        return;
+    }
+    ScopedFormatBuffer buffer;
+    FormatTo<Args...>(buffer.Get(), format, args...);
+    logger.LogAt(level, buffer.Get(), location);
+}
+
+} // namespace detail
+
+// Convenience macros: LOG_INFO(message) or LOG_INFO("format {}", args...). The
+// level is checked before the message or arguments are evaluated, and levels
+// below VISION_INFRA_LOG_MIN_LEVEL are removed at compile time.
+// VISION_INFRA_LOG_TO logs through a specific ILogger or LoggerHandle.
+#define VISION_INFRA_LOG_TO(logger, level, ...)                                                   \
+    do {                                                                                          \
+        if constexpr (static_cast<int>(level) >= VISION_INFRA_LOG_MIN_LEVEL) {                    \
+            ::vision_infra::core::ILogger& vision_infra_logger_ = (logger);                       \
+            if (vision_infra_logger_.IsEnabled(level)) {                                          \
+                ::vision_infra::core::detail::LogMessage(vision_infra_logger_, level,             \
+                                                         std::source_location::current(), __VA_ARGS__); \
+            }                                                                                     \
+        }                                                                                         \
+    } while (0)
+
+#define VISION_INFRA_LOG(level, ...) \
+    VISION_INFRA_LOG_TO(::vision_infra::core::LoggerManager::GetDefaultLoggerRef(), level, __VA_ARGS__)
+
+#define LOG_TRACE(...) VISION_INFRA_LOG(::vision_infra::core::LogLevel::TRACE, __VA_ARGS__)
+#define LOG_DEBUG(...) VISION_INFRA_LOG(::vision_infra::core::LogLevel::DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) VISION_INFRA_LOG(::vision_infra::core::LogLevel::INFO, __VA_ARGS__)
+#define LOG_WARN(...) VISION_INFRA_LOG(::vision_infra::core::LogLevel::WARN, __VA_ARGS__)
+#define LOG_ERROR(...) VISION_INFRA_LOG(::vision_infra::core::LogLevel::ERROR, __VA_ARGS__)
+#define LOG_FATAL(...) VISION_INFRA_LOG(::vision_infra::core::LogLevel::FATAL, __VA_ARGS__)
 
 } // namespace core
 } // namespace vision_infra
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Read-only memory-mapped view of a whole file. Owns the mapping, which is
+ * released on destruction; movable, not copyable. Pages are loaded on first
+ * access, so opening a large model or dataset file costs no copy and no
+ * resident memory up front.
+ */
+class MappedFile {
+public:
+    /**
+     * Expected access pattern, passed to the kernel as a paging hint
+     */
+    enum class AccessHint {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILL_NEED  // Start reading the whole file in ahead of use
+    };
+
+    MappedFile() noexcept = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Map path read-only; returns std::nullopt if it cannot be opened or mapped.
+     * Empty files yield an empty view.
+     */
+    static std::optional<MappedFile> Open(const std::string& path, AccessHint hint = AccessHint::NORMAL);
+
+    const uint8_t* Data() const noexcept { return data_; }
+    size_t Size() const noexcept { return size_; }
+    bool Empty() const noexcept { return size_ == 0; }
+
+    std::span<const uint8_t> Bytes() const noexcept { return {data_, size_}; }
+    std::string_view Text() const noexcept { return {reinterpret_cast<const char*>(data_), size_}; }
+
+private:
+    void Release() noexcept;
+
+    const uint8_t* data_{nullptr};
+    size_t size_{0};
+    std::unique_ptr<uint8_t[]> fallback_;  // Heap copy on platforms without mmap support here
+};
+
+} // namespace core
+} // namespace vision_infra
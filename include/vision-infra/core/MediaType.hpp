@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Kind of media a file holds, judged by its extension
+ */
+enum class MediaType {
+    UNKNOWN,
+    IMAGE,
+    VIDEO,
+    MODEL
+};
+
+namespace detail {
+
+inline constexpr std::string_view kImageExtensions[] = {
+    ".jpg", ".jpeg", ".png", ".bmp", ".gif", ".tiff", ".tif", ".webp",
+    ".ico", ".ppm", ".pgm", ".pbm", ".sr", ".ras", ".jp2"
+};
+
+inline constexpr std::string_view kVideoExtensions[] = {
+    ".mp4", ".avi", ".mkv", ".mov", ".wmv", ".flv", ".webm", ".m4v",
+    ".3gp", ".3g2", ".mxf", ".roq", ".nsv", ".f4v", ".f4p", ".f4a", ".f4b"
+};
+
+inline constexpr std::string_view kModelExtensions[] = {
+    ".onnx", ".pb", ".trt", ".engine", ".plan", ".pth", ".pt", ".h5",
+    ".savedmodel", ".tflite", ".mlmodel", ".bin", ".caffemodel", ".prototxt"
+};
+
+struct ExtensionKey {
+    std::string_view extension;
+    MediaType type{MediaType::UNKNOWN};
+};
+
+inline constexpr size_t kExtensionCount =
+    std::size(kImageExtensions) + std::size(kVideoExtensions) + std::size(kModelExtensions);
+
+// Power of two; at under a fifth full a collision-free seed turns up within a few dozen tries
+inline constexpr size_t kExtensionSlots = 256;
+
+constexpr char ToLowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// FNV-1a over the lowercased bytes, so lookups need no lowercase copy
+constexpr uint32_t HashExtension(std::string_view extension, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : extension) {
+        hash ^= static_cast<uint8_t>(ToLowerAscii(c));
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+constexpr std::array<ExtensionKey, kExtensionCount> MakeExtensionKeys() {
+    std::array<ExtensionKey, kExtensionCount> keys{};
+    size_t index = 0;
+    for (auto extension : kImageExtensions) {
+        keys[index++] = {extension, MediaType::IMAGE};
+    }
+    for (auto extension : kVideoExtensions) {
+        keys[index++] = {extension, MediaType::VIDEO};
+    }
+    for (auto extension : kModelExtensions) {
+        keys[index++] = {extension, MediaType::MODEL};
+    }
+    return keys;
+}
+
+inline constexpr auto kExtensionKeys = MakeExtensionKeys();
+
+constexpr size_t MaxExtensionLength() {
+    size_t length = 0;
+    for (const auto& key : kExtensionKeys) {
+        length = key.extension.size() > length ? key.extension.size() : length;
+    }
+    return length;
+}
+
+/**
+ * Perfect hash table: slots[hash & mask] holds a key index + 1, 0 when empty
+ */
+struct ExtensionTable {
+    uint32_t seed{0};
+    std::array<uint8_t, kExtensionSlots> slots{};
+};
+
+constexpr ExtensionTable BuildExtensionTable() {
+    for (uint32_t seed = 0; seed < 65536; ++seed) {
+        ExtensionTable table{seed, {}};
+        bool collision = false;
+        for (size_t i = 0; i < kExtensionKeys.size() && !collision; ++i) {
+            auto& slot = table.slots[HashExtension(kExtensionKeys[i].extension, seed) & (kExtensionSlots - 1)];
+            collision = slot != 0;
+            slot = static_cast<uint8_t>(i + 1);
+        }
+        if (!collision) {
+            return table;
+        }
+    }
+    // Reached only if the key set changes so that no seed works: a compile error
+    throw "no collision-free seed for the extension table";
+}
+
+inline constexpr size_t kMaxExtensionLength = MaxExtensionLength();
+inline constexpr ExtensionTable kExtensionTable = BuildExtensionTable();
+
+constexpr bool EqualsLowercase(std::string_view text, std::string_view lower) {
+    if (text.size() != lower.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (ToLowerAscii(text[i]) != lower[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * Media type of an extension such as ".JPG" (leading dot, any case); no allocation
+ */
+constexpr MediaType ClassifyExtension(std::string_view extension) {
+    if (extension.size() < 2 || extension.size() > detail::kMaxExtensionLength) {
+        return MediaType::UNKNOWN;
+    }
+    auto slot = detail::kExtensionTable.slots[
+        detail::HashExtension(extension, detail::kExtensionTable.seed) & (detail::kExtensionSlots - 1)];
+    if (slot == 0) {
+        return MediaType::UNKNOWN;
+    }
+    const auto& key = detail::kExtensionKeys[slot - 1];
+    return detail::EqualsLowercase(extension, key.extension) ? key.type : MediaType::UNKNOWN;
+}
+
+/**
+ * Extension of the file name in path, by the rules of std::filesystem::path::extension;
+ * both '/' and '\' separate directories
+ */
+constexpr std::string_view PathExtension(std::string_view path) {
+    auto separator = path.find_last_of("/\\");
+    auto name = separator == std::string_view::npos ? path : path.substr(separator + 1);
+    auto dot = name.rfind('.');
+    if (dot == std::string_view::npos || dot == 0 || name == "..") {
+        return {};
+    }
+    return name.substr(dot);
+}
+
+constexpr MediaType ClassifyPath(std::string_view path) {
+    return ClassifyExtension(PathExtension(path));
+}
+
+static_assert(ClassifyPath("frames/000.JPG") == MediaType::IMAGE);
+static_assert(ClassifyPath("model.caffemodel") == MediaType::MODEL);
+static_assert(ClassifyPath("notes.txt") == MediaType::UNKNOWN);
+
+} // namespace core
+} // namespace vision_infra
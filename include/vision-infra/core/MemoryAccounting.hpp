@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Subsystem that owns a tracked allocation
+ */
+enum class MemoryTag : uint8_t {
+    PREPROCESSING,  // TensorBufferPool
+    DATASET,        // DatasetLoader prefetched samples
+    CACHE,          // ImageCache
+    LOGGING,        // Async logger queue, file sink buffers
+    IO,             // FileWriter buffers
+    OTHER
+};
+
+inline constexpr size_t kMemoryTagCount = static_cast<size_t>(MemoryTag::OTHER) + 1;
+
+/**
+ * Memory accounting counters of one tag
+ */
+struct MemoryTagStats {
+    size_t live_bytes{0};
+    size_t peak_bytes{0};  // Highest live_bytes since startup or ResetPeaks()
+    uint64_t allocations{0};
+    uint64_t frees{0};
+};
+
+/**
+ * Opt-in, process-wide accounting of the memory the library's buffer paths
+ * hold, by subsystem. Disabled by default, when a MemoryCharge costs a single
+ * relaxed load; enabled, every change is a few relaxed atomic operations on
+ * the tag's counters. Complements the RSS figures of MemoryUtils.
+ *
+ * Enable before constructing the components to be measured: their charges
+ * are only counted if accounting was on when they were created.
+ */
+class MemoryAccounting {
+public:
+    static void SetEnabled(bool enabled) noexcept;
+    static bool IsEnabled() noexcept;
+
+    static MemoryTagStats GetStats(MemoryTag tag) noexcept;
+    static std::array<MemoryTagStats, kMemoryTagCount> GetAllStats() noexcept;
+
+    /**
+     * Restart peak tracking from the current live bytes
+     */
+    static void ResetPeaks() noexcept;
+
+    static std::string_view GetTagName(MemoryTag tag) noexcept;
+
+private:
+    friend class MemoryCharge;
+    static void Allocate(MemoryTag tag, size_t bytes) noexcept;
+    static void Free(MemoryTag tag, size_t bytes, uint64_t count) noexcept;
+};
+
+/**
+ * Bytes a component holds on behalf of a MemoryTag; whatever is still
+ * charged is freed on destruction, counting one free per live allocation.
+ * Inert if accounting was disabled when it was constructed. Movable, not
+ * copyable; not thread-safe, owners serialize access the same way they
+ * guard the memory itself.
+ */
+class MemoryCharge {
+public:
+    MemoryCharge() noexcept = default;
+    explicit MemoryCharge(MemoryTag tag) noexcept;
+    ~MemoryCharge();
+
+    MemoryCharge(MemoryCharge&& other) noexcept;
+    MemoryCharge& operator=(MemoryCharge&& other) noexcept;
+    MemoryCharge(const MemoryCharge&) = delete;
+    MemoryCharge& operator=(const MemoryCharge&) = delete;
+
+    /**
+     * Record one allocation of bytes; zero-byte calls are ignored
+     */
+    void Allocate(size_t bytes) noexcept;
+
+    /**
+     * Record count frees totalling bytes, at most Bytes()
+     */
+    void Free(size_t bytes, uint64_t count = 1) noexcept;
+
+    size_t Bytes() const noexcept { return bytes_; }
+    bool IsActive() const noexcept { return active_; }
+
+private:
+    void Reset() noexcept;
+
+    MemoryTag tag_{MemoryTag::OTHER};
+    bool active_{false};
+    size_t bytes_{0};
+    uint64_t allocations_{0};  // Allocations not yet freed
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Set to 0 to compile every PROFILE_* zone away
+#ifndef VISION_INFRA_ENABLE_PROFILING
+#define VISION_INFRA_ENABLE_PROFILING 1
+#endif
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Timing statistics of one profiler zone, in milliseconds. Percentiles are
+ * accurate to within 1/8 of their value.
+ */
+struct ProfileZoneStats {
+    static constexpr uint32_t kAllThreads = UINT32_MAX;
+    static constexpr uint32_t kRetiredThreads = UINT32_MAX - 1;  // All threads that have exited
+
+    std::string name;
+    uint32_t thread_index{kAllThreads};  // Profiler thread index, kAllThreads when merged
+    uint64_t count{0};
+    double total_ms{0.0};
+    double min_ms{0.0};
+    double max_ms{0.0};
+    double p50_ms{0.0};
+    double p90_ms{0.0};
+    double p99_ms{0.0};
+
+    double GetMeanMs() const { return count == 0 ? 0.0 : total_ms / static_cast<double>(count); }
+};
+
+/**
+ * Bounds of a timeline capture
+ */
+struct ProfileCaptureOptions {
+    std::chrono::milliseconds duration{5000};  // Zero: until StopCapture()
+    size_t max_events = 1u << 20;              // Zones past this are dropped from the capture
+};
+
+namespace detail {
+inline std::atomic<bool> g_profiler_enabled{false};
+} // namespace detail
+
+/**
+ * Process-wide scoped-zone profiler for hot paths.
+ *
+ * Zones (PROFILE_ZONE / PROFILE_FUNCTION) read a monotonic tick counter on
+ * entry and exit: the TSC on x86 CPUs with an invariant TSC, calibrated
+ * against std::chrono::steady_clock, and steady_clock nanoseconds elsewhere.
+ * Each thread appends finished zones to its own lock-free ring buffer; the
+ * thread calling GetStats() drains the rings and aggregates count, total,
+ * min, max and percentiles per zone and thread. Rings hold 16384 zones, so
+ * collect at least that often (e.g. once per second); zones finished while a
+ * ring is full are dropped and counted. Once a thread has exited and its
+ * ring is drained, its per-thread statistics are merged into a single
+ * kRetiredThreads entry per zone, so short-lived threads do not grow them.
+ *
+ * Disabled by default; a zone then costs one relaxed load.
+ */
+class Profiler {
+public:
+    static void SetEnabled(bool enabled) noexcept;
+    static bool IsEnabled() noexcept { return detail::g_profiler_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Zone id for name; the same name always maps to the same id
+     */
+    static uint32_t RegisterZone(std::string_view name);
+
+    /**
+     * Name the calling thread in reports
+     */
+    static void SetThreadName(std::string_view name);
+
+    /**
+     * Current tick count and the tick length in nanoseconds
+     */
+    static uint64_t Now() noexcept;
+    static double GetNanosecondsPerTick();
+    static bool UsesTsc() noexcept;
+
+    static void Record(uint32_t zone, uint64_t start_ticks, uint64_t end_ticks) noexcept;
+
+    /**
+     * Drain pending zones, then return the statistics gathered since the last
+     * Reset(), merged across threads or one entry per thread and zone, sorted
+     * by total time
+     */
+    static std::vector<ProfileZoneStats> GetStats(bool per_thread = false);
+
+    /**
+     * Name given with SetThreadName, "retired threads" for kRetiredThreads,
+     * or "thread <index>"
+     */
+    static std::string GetThreadName(uint32_t thread_index);
+
+    static uint64_t GetDroppedCount();
+
+    /**
+     * Discard pending zones and statistics; zone ids stay valid
+     */
+    static void Reset();
+
+    /**
+     * Table of GetStats() for logs and consoles
+     */
+    static std::string FormatReport(bool per_thread = false);
+
+    /**
+     * Start recording individual zones for a timeline, enabling profiling
+     * until the capture ends. A background thread drains the rings while
+     * the capture runs and ends it after options.duration. Returns false if
+     * a capture is already running.
+     */
+    static bool StartCapture(const ProfileCaptureOptions& options = {});
+    static void StopCapture();
+    static bool IsCapturing();
+
+    /**
+     * The current or last capture in Chrome Trace Event format, loadable in
+     * chrome://tracing and the Perfetto UI: one complete event per zone,
+     * nested by time on its thread, plus thread name metadata
+     */
+    static std::string FormatChromeTrace();
+    static bool WriteChromeTrace(const std::string& path);
+
+    /**
+     * Make signal signum start a capture with options and write it to path
+     * when it ends. POSIX only; returns false if the handler could not be
+     * installed.
+     */
+    static bool InstallCaptureSignal(int signum, const std::string& path, const ProfileCaptureOptions& options = {});
+};
+
+/**
+ * Times the enclosing scope as one zone if profiling is enabled on entry
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(uint32_t zone) noexcept
+        : zone_(zone), start_(Profiler::IsEnabled() ? Profiler::Now() : 0) {}
+
+    ~ProfileScope() {
+        if (start_ != 0) {
+            Profiler::Record(zone_, start_, Profiler::Now());
+        }
+    }
+
+    // Disable copy and move operations
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+    ProfileScope(ProfileScope&&) = delete;
+    ProfileScope& operator=(ProfileScope&&) = delete;
+
+private:
+    uint32_t zone_;
+    uint64_t start_;
+};
+
+// Zone macros: PROFILE_ZONE("stage.name") times the rest of the enclosing
+// scope, PROFILE_FUNCTION() the enclosing function. The name is registered
+// once per call site.
+#define VISION_INFRA_PROFILE_CONCAT_(a, b) a##b
+#define VISION_INFRA_PROFILE_CONCAT(a, b) VISION_INFRA_PROFILE_CONCAT_(a, b)
+
+#if VISION_INFRA_ENABLE_PROFILING
+#define VISION_INFRA_PROFILE_ZONE(name)                                                                   \
+    static const uint32_t VISION_INFRA_PROFILE_CONCAT(vision_infra_zone_, __LINE__) =                    \
+        ::vision_infra::core::Profiler::RegisterZone(name);                                               \
+    ::vision_infra::core::ProfileScope VISION_INFRA_PROFILE_CONCAT(vision_infra_scope_, __LINE__)(        \
+        VISION_INFRA_PROFILE_CONCAT(vision_infra_zone_, __LINE__))
+#else
+#define VISION_INFRA_PROFILE_ZONE(name) static_cast<void>(0)
+#endif
+
+#define PROFILE_ZONE(name) VISION_INFRA_PROFILE_ZONE(name)
+#define PROFILE_FUNCTION() VISION_INFRA_PROFILE_ZONE(__func__)
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "vision-infra/core/Logger.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Log file writer that batches lines into a large buffer and rotates the file.
+ *
+ * Lines are written to disk when the buffer fills, when a line at or above
+ * FileSinkOptions::flush_level arrives, or once flush_interval has elapsed
+ * since the last write to disk. Write() only checks the interval when a line
+ * arrives; the owner calls FlushIfDue() by GetFlushDeadline() so that a quiet
+ * log still reaches the disk (Logger does this from its async writer or a
+ * timer thread). Flush() and destruction write whatever is left.
+ * Rotated files are named by inserting an index before the extension
+ * (app.log -> app.1.log, app.2.log, ...), app.1.log being the most recent.
+ *
+ * Not thread-safe; Logger serializes access to its sink.
+ */
+class RotatingFileSink {
+public:
+    /**
+     * Opens (appending to) path; throws std::runtime_error if it cannot be opened
+     */
+    explicit RotatingFileSink(const std::string& path, const FileSinkOptions& options = {});
+    ~RotatingFileSink();
+
+    // Disable copy and move operations
+    RotatingFileSink(const RotatingFileSink&) = delete;
+    RotatingFileSink& operator=(const RotatingFileSink&) = delete;
+    RotatingFileSink(RotatingFileSink&&) = delete;
+    RotatingFileSink& operator=(RotatingFileSink&&) = delete;
+
+    /**
+     * Append one formatted line (including its newline)
+     */
+    void Write(std::string_view line, LogLevel level);
+    void Flush();
+
+    /**
+     * Write buffered lines if flush_interval has elapsed since the last write
+     * to disk
+     */
+    void FlushIfDue();
+
+    /**
+     * When the buffered lines fall due under flush_interval; nullopt while
+     * nothing is buffered
+     */
+    std::optional<std::chrono::steady_clock::time_point> GetFlushDeadline() const noexcept;
+
+    /**
+     * Close the current file and start a new one, shifting older files. Does
+     * not throw: if the new file cannot be opened, lines keep going to the old
+     * one, the error is reported on stderr and kept for GetLastError(), and
+     * rotation is retried after another max_file_size bytes or
+     * rotation_interval.
+     */
+    void Rotate();
+
+    const std::string& GetPath() const noexcept;
+
+    /**
+     * Size of the current file including buffered bytes
+     */
+    uint64_t GetFileSize() const noexcept;
+
+    /**
+     * Most recent rotation failure; empty if rotation never failed
+     */
+    const std::string& GetLastError() const noexcept;
+
+    /**
+     * Path of the index-th rotated file (1 = most recent)
+     */
+    static std::string RotatedPath(const std::string& path, size_t index);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "vision-infra/core/LatencyHistogram.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Configuration options for StreamMetrics
+ */
+struct StreamMetricsOptions {
+    size_t max_streams = 1024;                        // Registration beyond this throws
+    std::chrono::milliseconds stall_timeout{2000};    // No frame for this long marks a stream stalled
+};
+
+/**
+ * One stream in a StreamMetricsSnapshot
+ */
+struct StreamStats {
+    uint32_t id{0};
+    std::string name;
+    uint64_t frames{0};
+    uint64_t dropped{0};
+    double fps{0.0};                  // Since the previous Snapshot(), or registration
+    double average_fps{0.0};          // Since registration
+    double ms_since_last_frame{0.0};  // Since registration while no frame arrived
+    bool stalled{false};
+    LatencyStats latency;             // Since registration or ResetLatency()
+};
+
+/**
+ * All streams at one point in time, plus totals
+ */
+struct StreamMetricsSnapshot {
+    std::vector<StreamStats> streams;  // By id
+    uint64_t total_frames{0};
+    uint64_t total_dropped{0};
+    double total_fps{0.0};
+    size_t stalled_streams{0};
+    LatencyStats latency;  // All streams merged
+
+    /**
+     * The n streams with the lowest frame rate, stalled streams first
+     */
+    std::vector<StreamStats> GetSlowest(size_t n) const;
+};
+
+/**
+ * Frame rate and latency of many concurrent streams (e.g. one per camera).
+ *
+ * RegisterStream() returns an id that the stream's threads pass to
+ * RecordFrame() / RecordDrop(). Recording takes no lock: each stream owns
+ * cache-line-aligned atomic counters and a LatencyHistogram, so any number
+ * of threads can record into any streams at once. Snapshot() reads all
+ * streams without blocking the recorders; frame rates are measured over the
+ * interval since the previous snapshot, so take snapshots at a steady
+ * cadence (e.g. once per second) from one monitoring thread.
+ */
+class StreamMetrics {
+public:
+    using StreamId = uint32_t;
+
+    explicit StreamMetrics(const StreamMetricsOptions& options = {});
+    ~StreamMetrics();
+
+    // Disable copy and move operations
+    StreamMetrics(const StreamMetrics&) = delete;
+    StreamMetrics& operator=(const StreamMetrics&) = delete;
+    StreamMetrics(StreamMetrics&&) = delete;
+    StreamMetrics& operator=(StreamMetrics&&) = delete;
+
+    /**
+     * Id of the stream called name, registering it on first use. Throws
+     * std::runtime_error once max_streams streams exist.
+     */
+    StreamId RegisterStream(const std::string& name);
+
+    /**
+     * Count a frame of stream id, optionally with its end-to-end latency.
+     * Unknown ids are ignored.
+     */
+    void RecordFrame(StreamId id) noexcept;
+    void RecordFrame(StreamId id, std::chrono::nanoseconds latency) noexcept;
+    void RecordDrop(StreamId id) noexcept;
+
+    /**
+     * Current statistics of every stream. Latency percentiles cost a few
+     * microseconds per stream; skip them with include_latency = false.
+     */
+    StreamMetricsSnapshot Snapshot(bool include_latency = true);
+
+    void ResetLatency();
+    size_t GetStreamCount() const;
+
+    /**
+     * Totals and the slowest streams of snapshot, for logs and consoles
+     */
+    static std::string FormatSnapshot(const StreamMetricsSnapshot& snapshot, size_t slowest = 10);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Fixed-size worker pool for CPU-bound work.
+ * Typically sized from InferenceConfig::GetNumThreads(); 0 uses the hardware concurrency.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t num_threads = 0);
+    ~ThreadPool();
+
+    // Disable copy and move operations
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    size_t GetNumThreads() const noexcept;
+
+    /**
+     * Queue a task and get a future for its result
+     */
+    template<typename F>
+    auto Submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+
+    /**
+     * Run fn(i) for every i in [begin, end) on the pool and the calling thread,
+     * returning once all calls completed. The first exception thrown is rethrown.
+     * Safe to call from inside a pool task.
+     */
+    void ParallelFor(size_t begin, size_t end, const std::function<void(size_t)>& fn);
+
+private:
+    void Enqueue(std::function<void()> task);
+
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+template<typename F>
+auto ThreadPool::Submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+    auto future = packaged->get_future();
+    Enqueue([packaged]() { (*packaged)(); });
+    return future;
+}
+
+} // namespace core
+} // namespace vision_infra
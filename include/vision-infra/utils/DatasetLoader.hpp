@@ -0,0 +1,97 @@
+#pragma once
+
+#include "vision-infra/core/AsyncFileIO.hpp"
+#include "vision-infra/core/ThreadPool.hpp"
+#include "vision-infra/utils/VisionUtils.hpp"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vision_infra {
+namespace utils {
+
+/**
+ * Dataset loader options
+ */
+struct DatasetLoaderOptions {
+    ImageUtils::PreprocessOptions preprocess;
+    size_t prefetch_depth = 16;            // Samples being read, decoded or waiting for the consumer
+    bool ordered = true;                   // Deliver in path order; false delivers as soon as ready
+    int decode_flags = cv::IMREAD_COLOR;   // cv::imdecode flags; the channel count sets the tensor shape
+};
+
+/**
+ * One preprocessed image
+ */
+struct DatasetSample {
+    size_t index{0};                      // Position in the loader's path list
+    std::string path;
+    bool ok{false};                       // false if the file could not be read or decoded
+    std::vector<float> tensor;            // CHW, channels x target height x target width
+    int channels{0};
+    cv::Size original_size;
+    ImageUtils::LetterboxInfo letterbox;
+};
+
+/**
+ * Prefetching image pipeline: read (AsyncFileIO) -> decode -> letterbox and
+ * normalize (ImageUtils::PreprocessToChw) -> consumer.
+ *
+ * Up to prefetch_depth samples are in the pipeline at once; reads stay in
+ * flight on the I/O engine while earlier images decode on the pool, and a
+ * new read starts each time the consumer takes a sample. Files that fail to
+ * read or decode are delivered with ok == false rather than skipped, so
+ * indices stay aligned with the path list.
+ *
+ * Next() and NextBatch() are meant for a single consumer thread. The pool and
+ * I/O engine must outlive the loader; its destructor waits for work in flight.
+ */
+class DatasetLoader {
+public:
+    /**
+     * Starts prefetching immediately. A null io uses AsyncFileIO::GetDefault().
+     */
+    DatasetLoader(std::vector<std::string> paths, const DatasetLoaderOptions& options, core::ThreadPool& pool,
+                  std::shared_ptr<core::AsyncFileIO> io = nullptr);
+    ~DatasetLoader();
+
+    // Disable copy and move operations
+    DatasetLoader(const DatasetLoader&) = delete;
+    DatasetLoader& operator=(const DatasetLoader&) = delete;
+    DatasetLoader(DatasetLoader&&) = delete;
+    DatasetLoader& operator=(DatasetLoader&&) = delete;
+
+    /**
+     * Sorted image files under directory, found with core::DirectoryScanner on pool
+     */
+    static std::vector<std::string> FindImages(const std::string& directory, core::ThreadPool& pool,
+                                               bool recursive = true);
+
+    /**
+     * Wait for the next sample; returns false once every path was delivered
+     */
+    bool Next(DatasetSample& sample);
+
+    /**
+     * Copy up to batch_size successfully loaded samples into output as one
+     * contiguous NCHW batch (see ImageUtils::GetBatchShape), zeroing unused
+     * slots. samples receives their metadata, without tensors, and failed
+     * samples are reported there too with ok == false. Returns the number of
+     * images written; 0 means the dataset is exhausted. output must hold
+     * batch_size images of the channel count decode_flags yields (4 when the
+     * flags keep the file's own layout); otherwise std::invalid_argument is
+     * thrown before any sample is taken.
+     */
+    size_t NextBatch(size_t batch_size, std::span<float> output, std::vector<DatasetSample>& samples);
+
+    size_t Size() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace utils
+} // namespace vision_infra
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "vision-infra/utils/VisionUtils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vision_infra {
+namespace utils {
+
+/**
+ * Image cache statistics
+ */
+struct ImageCacheStats {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+    size_t entries{0};
+    size_t bytes{0};
+
+    double GetHitRate() const {
+        auto lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+};
+
+/**
+ * Preprocessed tensor held by ImageCache
+ */
+struct CachedTensor {
+    std::shared_ptr<const std::vector<float>> data;  // CHW
+    int channels{0};
+    cv::Size original_size;
+    ImageUtils::LetterboxInfo letterbox;
+};
+
+/**
+ * LRU cache of decoded images and preprocessed tensors, bounded by a byte
+ * budget (images are charged MemoryUtils::GetImageMemorySize).
+ *
+ * Entries are keyed by path, decode flags and, for tensors, every
+ * PreprocessOptions field, and remember the file's modification time: an
+ * entry whose file changed since it was cached counts as a miss and is
+ * replaced. Entries larger than the whole budget are never cached.
+ *
+ * Thread-safe. Decoding and preprocessing on a miss run outside the lock, so
+ * two threads missing on the same key may both do the work.
+ */
+class ImageCache {
+public:
+    explicit ImageCache(size_t budget_bytes);
+    ~ImageCache();
+
+    // Disable copy and move operations
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+    ImageCache(ImageCache&&) = delete;
+    ImageCache& operator=(ImageCache&&) = delete;
+
+    /**
+     * Decoded image, read with cv::imread on a miss; empty if the file cannot
+     * be decoded. The pixels are shared with the cache: treat them as read-only.
+     */
+    cv::Mat GetImage(const std::string& path, int decode_flags = cv::IMREAD_COLOR);
+
+    /**
+     * Letterboxed CHW tensor (ImageUtils::PreprocessToChw), computed on a miss
+     * from the cached decoded image if there is one; a miss does not add the
+     * decoded image to the cache. std::nullopt if the file cannot be decoded.
+     */
+    std::optional<CachedTensor> GetTensor(const std::string& path, const ImageUtils::PreprocessOptions& options,
+                                          int decode_flags = cv::IMREAD_COLOR);
+
+    /**
+     * Shrinking the budget evicts least recently used entries right away
+     */
+    void SetBudget(size_t budget_bytes);
+    size_t GetBudget() const;
+
+    ImageCacheStats GetStats() const;
+    void ResetStats();
+    void Clear();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace utils
+} // namespace vision_infra
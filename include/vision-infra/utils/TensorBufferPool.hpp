@@ -0,0 +1,140 @@
+#pragma once
+
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include "vision-infra/utils/VisionUtils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace vision_infra {
+namespace utils {
+
+class TensorBufferPool;
+
+/**
+ * Tensor buffer pool options
+ */
+struct TensorBufferPoolOptions {
+    size_t alignment{64};  // Power of two; 64 keeps every buffer on its own cache lines
+    bool use_huge_pages{false};  // Back buffers of 2 MiB and more with transparent huge pages (Linux),
+                                 // mapped at a 2 MiB boundary or alignment, whichever is larger
+    size_t max_cached_bytes{std::numeric_limits<size_t>::max()};  // Idle bytes kept for reuse
+    core::MemoryTag tag{core::MemoryTag::PREPROCESSING};  // Charged for every buffer the pool owns
+};
+
+/**
+ * Tensor buffer pool statistics
+ */
+struct TensorBufferPoolStats {
+    uint64_t acquires{0};
+    uint64_t reuses{0};       // Acquires served from an idle buffer
+    uint64_t allocations{0};  // Acquires that had to allocate
+    size_t bytes_in_use{0};   // Capacity of buffers currently handed out
+    size_t bytes_cached{0};   // Capacity of idle buffers held by the pool
+
+    double GetReuseRate() const {
+        return acquires == 0 ? 0.0 : static_cast<double>(reuses) / static_cast<double>(acquires);
+    }
+};
+
+/**
+ * Aligned block of raw memory on loan from a TensorBufferPool; returned to
+ * the pool on destruction. Movable, not copyable. The pool must outlive it.
+ */
+class TensorBuffer {
+public:
+    TensorBuffer() noexcept = default;
+    ~TensorBuffer();
+
+    TensorBuffer(TensorBuffer&& other) noexcept;
+    TensorBuffer& operator=(TensorBuffer&& other) noexcept;
+    TensorBuffer(const TensorBuffer&) = delete;
+    TensorBuffer& operator=(const TensorBuffer&) = delete;
+
+    void* Data() const noexcept { return data_; }
+    size_t Size() const noexcept { return size_; }          // Bytes requested
+    size_t Capacity() const noexcept { return capacity_; }  // Bytes usable
+    bool Empty() const noexcept { return data_ == nullptr; }
+
+    template<typename T>
+    std::span<T> As() const noexcept {
+        return {static_cast<T*>(data_), size_ / sizeof(T)};
+    }
+
+    /**
+     * cv::Mat header over the buffer, without copying; the Mat does not own
+     * the memory and must not outlive the buffer. Throws std::invalid_argument
+     * if the shape does not fit in Capacity().
+     */
+    cv::Mat AsMat(int rows, int cols, int type) const;
+    cv::Mat AsMat(const std::vector<int>& sizes, int type) const;
+
+    /**
+     * Give the memory back to the pool early
+     */
+    void Release() noexcept;
+
+private:
+    friend class TensorBufferPool;
+    TensorBuffer(TensorBufferPool* pool, void* data, size_t size, size_t capacity) noexcept
+        : pool_(pool), data_(data), size_(size), capacity_(capacity) {}
+
+    TensorBufferPool* pool_{nullptr};
+    void* data_{nullptr};
+    size_t size_{0};
+    size_t capacity_{0};
+};
+
+/**
+ * Thread-safe pool of aligned buffers for preprocessing outputs and other
+ * tensors. Requests are rounded up to power-of-two size classes and released
+ * buffers are kept per class, so once a stream's shapes stop changing every
+ * Acquire is served from an idle buffer and nothing is allocated per frame.
+ *
+ * Pair with the output-parameter ImageUtils functions and
+ * PreprocessToChw through TensorBuffer::AsMat / As<T>.
+ */
+class TensorBufferPool {
+public:
+    explicit TensorBufferPool(const TensorBufferPoolOptions& options = {});
+    ~TensorBufferPool();
+
+    // Disable copy and move operations
+    TensorBufferPool(const TensorBufferPool&) = delete;
+    TensorBufferPool& operator=(const TensorBufferPool&) = delete;
+    TensorBufferPool(TensorBufferPool&&) = delete;
+    TensorBufferPool& operator=(TensorBufferPool&&) = delete;
+
+    /**
+     * Buffer of at least bytes bytes; an empty buffer for 0. Throws
+     * std::bad_alloc if memory cannot be allocated.
+     */
+    TensorBuffer Acquire(size_t bytes);
+    TensorBuffer Acquire(const std::vector<int64_t>& shape, size_t element_size);
+
+    /**
+     * Free every idle buffer
+     */
+    void Trim();
+
+    TensorBufferPoolStats GetStats() const;
+    void ResetStats();
+
+    /**
+     * Capacity Acquire(bytes) hands out
+     */
+    static size_t GetSizeClass(size_t bytes);
+
+private:
+    friend class TensorBuffer;
+    void Release(void* data, size_t capacity) noexcept;
+
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace utils
+} // namespace vision_infra
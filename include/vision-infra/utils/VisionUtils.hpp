@@ -1,9 +1,13 @@
 #pragma once
 
+#include "vision-infra/core/ThreadPool.hpp"
 #include <opencv2/opencv.hpp>
 #include <string>
 #include <vector>
+#include <span>
 #include <cstdint>
+#include <chrono>
+#include <memory>
 
 namespace vision_infra {
 namespace utils {
@@ -63,14 +67,107 @@ public:
  */
 class ImageUtils {
 public:
+    /**
+     * Parameters for the fused letterbox + normalize + HWC->CHW path.
+     * Each output value is (pixel * scale - mean[c]) / std[c], where c is the
+     * output plane, so mean and std are given in the order after swap_rb
+     * (RGB for a BGR input), as in cv::dnn::blobFromImage. Channels without a mean/std entry use 0 and 1.
+     * fill_color is given in input channel order.
+     */
+    struct PreprocessOptions {
+        cv::Size target_size{640, 640};
+        std::vector<float> mean;
+        std::vector<float> std;
+        float scale{1.0f / 255.0f};
+        bool swap_rb{false};
+        cv::Scalar fill_color{114, 114, 114};
+    };
+
+    /**
+     * Letterbox geometry, used to map outputs back to source image coordinates:
+     * source = (output - pad) / scale
+     */
+    struct LetterboxInfo {
+        float scale{1.0f};
+        int pad_x{0};
+        int pad_y{0};
+        cv::Size resized_size;
+    };
+
+    static LetterboxInfo ComputeLetterbox(const cv::Size& image_size, const cv::Size& target_size);
+
+    /**
+     * Resize with preserved aspect ratio, pad, normalize and write planar CHW
+     * floats into output in a single pass, without intermediate images.
+     * Expects an 8-bit image with 1-4 channels; output must hold at least
+     * channels * target height * target width values.
+     */
+    static LetterboxInfo PreprocessToChw(const cv::Mat& image, const PreprocessOptions& options,
+                                         std::span<float> output);
+
+    /**
+     * uint8 variant for models that normalize on device: writes the resized,
+     * padded pixels as planar CHW bytes; mean, std and scale are ignored.
+     */
+    static LetterboxInfo PreprocessToChw(const cv::Mat& image, const PreprocessOptions& options,
+                                         std::span<uint8_t> output);
+
+    /**
+     * Preprocess a batch of images straight into one contiguous NCHW buffer.
+     * The buffer capacity (e.g. sized via GetBatchShape) may exceed
+     * images.size(); unused batch slots are zeroed.
+     * Returns the letterbox geometry of each image, in input order.
+     */
+    static std::vector<LetterboxInfo> BatchImages(const std::vector<cv::Mat>& images,
+                                                  const PreprocessOptions& options,
+                                                  std::span<float> output);
+    static std::vector<LetterboxInfo> BatchImages(const std::vector<cv::Mat>& images,
+                                                  const PreprocessOptions& options,
+                                                  std::span<uint8_t> output);
+
+    /**
+     * Parallel variants: images, and row bands of each image when the batch is
+     * smaller than the pool, are spread across the pool's workers. A pool sized
+     * from InferenceConfig::GetNumThreads() is the intended use.
+     */
+    static LetterboxInfo PreprocessToChw(const cv::Mat& image, const PreprocessOptions& options,
+                                         std::span<float> output, core::ThreadPool& pool);
+    static std::vector<LetterboxInfo> BatchImages(const std::vector<cv::Mat>& images,
+                                                  const PreprocessOptions& options,
+                                                  std::span<float> output, core::ThreadPool& pool);
+    static std::vector<LetterboxInfo> BatchImages(const std::vector<cv::Mat>& images,
+                                                  const PreprocessOptions& options,
+                                                  std::span<uint8_t> output, core::ThreadPool& pool);
+
+    /**
+     * NCHW shape of a batch tensor, suitable for MemoryUtils::GetTensorMemorySize
+     */
+    static std::vector<int64_t> GetBatchShape(size_t batch_size, int channels, const cv::Size& target_size);
+
     static cv::Mat ResizeKeepAspectRatio(const cv::Mat& image, const cv::Size& target_size,
                                         const cv::Scalar& fill_color = cv::Scalar(114, 114, 114));
     static cv::Mat CenterCrop(const cv::Mat& image, const cv::Size& crop_size);
     static cv::Mat Normalize(const cv::Mat& image, const std::vector<float>& mean,
                             const std::vector<float>& std);
-    static std::vector<cv::Mat> BatchImages(const std::vector<cv::Mat>& images);
     static cv::Mat HwcToChw(const cv::Mat& image);
     static cv::Mat ChwToHwc(const cv::Mat& image);
+
+    /**
+     * Variants that write into output instead of returning a new image. output
+     * is reused as-is when it already has the result's shape and type (the
+     * previous frame's result, or a TensorBuffer::AsMat view) and reallocated
+     * otherwise, so a steady stream allocates nothing. output must not alias
+     * image, except for Normalize.
+     */
+    static void ResizeKeepAspectRatio(const cv::Mat& image, const cv::Size& target_size, cv::Mat& output,
+                                      const cv::Scalar& fill_color = cv::Scalar(114, 114, 114));
+    static void Normalize(const cv::Mat& image, const std::vector<float>& mean,
+                          const std::vector<float>& std, cv::Mat& output);
+    /**
+     * CHW output is a 3-dimensional single-channel Mat of channels x rows x cols
+     */
+    static void HwcToChw(const cv::Mat& image, cv::Mat& output);
+    static void ChwToHwc(const cv::Mat& image, cv::Mat& output);
 };
 
 /**
@@ -93,19 +190,50 @@ public:
         bool is_running_{false};
     };
     
+    /**
+     * Frame rate over the last window_size frames and since construction,
+     * with nanosecond timestamps. Every call is O(1) (amortized for Update()).
+     * Frame intervals longer than deadline_ms, when positive, count as
+     * deadline misses.
+     */
     class FPSCounter {
     public:
-        explicit FPSCounter(size_t window_size = 30);
+        using Clock = std::chrono::steady_clock;
+
+        explicit FPSCounter(size_t window_size = 30, double deadline_ms = 0.0);
         void Update();
-        double GetCurrentFPS() const;
-        double GetAverageFPS() const;
+        /**
+         * Record a frame at timestamp (e.g. its capture time); timestamps
+         * must not decrease
+         */
+        void Update(Clock::time_point timestamp);
+
+        double GetInstantFPS() const;   // From the latest frame interval
+        double GetCurrentFPS() const;   // Over the rolling window
+        double GetAverageFPS() const;   // Since construction or Reset()
+
+        /**
+         * Standard deviation of the frame intervals in the window (jitter)
+         */
+        double GetIntervalStdDevMs() const;
+        uint64_t GetFrameCount() const { return frame_count_; }
+        uint64_t GetDeadlineMissCount() const { return deadline_misses_; }
         void Reset();
-        
+
     private:
-        std::vector<std::chrono::high_resolution_clock::time_point> timestamps_;
+        void ResyncWindowSums();
+
+        std::vector<Clock::time_point> timestamps_;  // Ring of the window's frames
         size_t window_size_;
-        size_t current_index_{0};
-        bool buffer_full_{false};
+        size_t current_index_{0};  // Next slot to write
+        size_t window_frames_{0};
+        double deadline_ms_;
+        uint64_t frame_count_{0};
+        uint64_t deadline_misses_{0};
+        double interval_sum_ms_{0.0};     // Over the window's intervals
+        double interval_sq_sum_ms_{0.0};
+        Clock::time_point first_timestamp_;
+        Clock::time_point last_timestamp_;
     };
 };
 
@@ -114,11 +242,87 @@ public:
  */
 class MemoryUtils {
 public:
+    /**
+     * Memory of the calling process, in bytes
+     */
+    struct ProcessMemoryInfo {
+        size_t rss{0};           // Resident set size
+        size_t peak_rss{0};      // Highest RSS since the process started (VmHWM)
+        size_t virtual_size{0};
+        size_t swap{0};
+        size_t pss{0};           // Proportional set size (shared pages split between users); detailed only
+    };
+    
+    /**
+     * System-wide memory, in bytes
+     */
+    struct SystemMemoryInfo {
+        size_t total{0};
+        size_t free{0};
+        size_t available{0};     // Allocatable without swapping, including reclaimable cache
+    };
+    
+    /**
+     * Background sampler of the process RSS that tracks the peak over a
+     * sliding time window as well as since Start(). Each sample is a single
+     * small read of /proc/self/statm.
+     */
+    class Sampler {
+    public:
+        explicit Sampler(std::chrono::milliseconds interval = std::chrono::milliseconds(100),
+                         std::chrono::milliseconds window = std::chrono::seconds(60));
+        ~Sampler();
+        
+        // Disable copy and move operations
+        Sampler(const Sampler&) = delete;
+        Sampler& operator=(const Sampler&) = delete;
+        Sampler(Sampler&&) = delete;
+        Sampler& operator=(Sampler&&) = delete;
+        
+        /**
+         * Start sampling on a background thread; restarting resets the peaks
+         */
+        void Start();
+        void Stop();
+        bool IsRunning() const;
+        
+        size_t GetCurrentRss() const;
+        size_t GetWindowPeakRss() const;
+        size_t GetPeakRss() const;
+        size_t GetSampleCount() const;
+        
+    private:
+        class Impl;
+        std::unique_ptr<Impl> pImpl_;
+    };
+    
     static size_t GetImageMemorySize(const cv::Mat& image);
     static size_t GetTensorMemorySize(const std::vector<int64_t>& shape, size_t element_size);
     static std::string FormatBytes(size_t bytes);
+    
+    /**
+     * Used system memory (total - available); 0 where unsupported
+     */
     static size_t GetSystemMemoryUsage();
+    
+    /**
+     * Process RSS from one small /proc read, cheap enough to poll per frame;
+     * 0 where unsupported
+     */
     static size_t GetProcessMemoryUsage();
+    
+    /**
+     * detailed also reads PSS from /proc/self/smaps_rollup, which walks every
+     * mapping and costs far more than the other fields
+     */
+    static ProcessMemoryInfo GetProcessMemoryInfo(bool detailed = false);
+    static SystemMemoryInfo GetSystemMemoryInfo();
+    
+    /**
+     * One line per core::MemoryAccounting tag with live and peak bytes and
+     * allocation counts; empty while accounting is disabled
+     */
+    static std::string FormatAccountingReport();
 };
 
 } // namespace utils
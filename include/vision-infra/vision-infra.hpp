@@ -8,10 +8,22 @@
 
 // Core module  
 #include "core/Logger.hpp"
+#include "core/BinaryLogReader.hpp"
+#include "core/RotatingFileSink.hpp"
 #include "core/FileSystem.hpp"
+#include "core/DirectoryScanner.hpp"
+#include "core/AsyncFileIO.hpp"
+#include "core/ThreadPool.hpp"
+#include "core/MemoryAccounting.hpp"
+#include "core/Profiler.hpp"
+#include "core/LatencyHistogram.hpp"
+#include "core/StreamMetrics.hpp"
 
 // Utils module
 #include "utils/VisionUtils.hpp"
+#include "utils/DatasetLoader.hpp"
+#include "utils/ImageCache.hpp"
+#include "utils/TensorBufferPool.hpp"
 
 // Convenience namespace alias
 namespace vi = vision_infra;
\ No newline at end of file
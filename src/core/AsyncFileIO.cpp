@@ -0,0 +1,567 @@
+#include "vision-infra/core/AsyncFileIO.hpp"
+#include "vision-infra/core/FileSystem.hpp"
+#include "vision-infra/core/ThreadPool.hpp"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define VISION_INFRA_HAS_IO_URING 1
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define VISION_INFRA_HAS_IO_URING 0
+#endif
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+/**
+ * One submitted read or write, as seen by the backends
+ */
+struct IoRequest {
+    enum class Kind {
+        READ,
+        WRITE
+    };
+
+    Kind kind{Kind::READ};
+    std::string path;
+    std::vector<uint8_t> data;  // Read result, or the bytes to write
+    AsyncFileIO::ReadCallback on_read;
+    AsyncFileIO::WriteCallback on_write;
+
+    void Complete(bool ok) {
+        try {
+            if (kind == Kind::READ) {
+                on_read(ok ? std::optional<std::vector<uint8_t>>(std::move(data)) : std::nullopt);
+            } else {
+                on_write(ok);
+            }
+        } catch (...) {
+            // A throwing callback must not take the engine thread down with it
+        }
+    }
+};
+
+class IoBackend {
+public:
+    virtual ~IoBackend() = default;
+    virtual void Submit(std::unique_ptr<IoRequest> request) = 0;
+};
+
+/**
+ * Blocking FileSystem calls on a dedicated pool, one request per thread
+ */
+class ThreadPoolBackend : public IoBackend {
+public:
+    explicit ThreadPoolBackend(size_t num_threads) : pool_(num_threads) {}
+
+    void Submit(std::unique_ptr<IoRequest> request) override {
+        pool_.Submit([this, request = std::move(request)] {
+            if (request->kind == IoRequest::Kind::READ) {
+                auto content = file_system_.ReadBinaryFile(request->path);
+                if (content) {
+                    request->data = std::move(*content);
+                }
+                request->Complete(content.has_value());
+            } else {
+                request->Complete(file_system_.WriteBinaryFile(request->path, request->data));
+            }
+        });
+    }
+
+private:
+    FileSystem file_system_;
+    ThreadPool pool_;  // Declared last: its destructor drains tasks that use file_system_
+};
+
+#if VISION_INFRA_HAS_IO_URING
+
+/**
+ * Minimal io_uring wrapper over the raw system calls (no liburing dependency).
+ * Only the owning thread may touch it.
+ */
+class IoUring {
+public:
+    IoUring() = default;
+
+    ~IoUring() {
+        if (sqes_) {
+            ::munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ && cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_) {
+            ::munmap(sq_ring_, sq_ring_size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    bool Init(unsigned entries) {
+        io_uring_params params{};
+        fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            return false;
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = Map(sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ = single_mmap ? sq_ring_ : Map(cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(Map(sqes_size_, IORING_OFF_SQES));
+        if (!sq_ring_ || !cq_ring_ || !sqes_) {
+            return false;
+        }
+
+        auto* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+        auto* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        local_tail_ = *sq_tail_;
+        entries_ = params.sq_entries;
+        return true;
+    }
+
+    unsigned Entries() const noexcept { return entries_; }
+
+    bool SupportsOps(std::initializer_list<uint8_t> ops) const {
+        constexpr unsigned kProbeOps = 256;
+        std::vector<uint8_t> storage(sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op));
+        auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+        if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+            return false;
+        }
+        return std::all_of(ops.begin(), ops.end(), [probe](uint8_t op) {
+            return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+        });
+    }
+
+    /**
+     * Zeroed SQE to fill in; the caller keeps no more than Entries() outstanding
+     */
+    io_uring_sqe* NextSqe() {
+        uint32_t index = local_tail_ & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sq_array_[index] = index;
+        ++local_tail_;
+        return sqe;
+    }
+
+    /**
+     * Submit queued SQEs and wait for at least one completion
+     */
+    void SubmitAndWait() {
+        std::atomic_ref<uint32_t>(*sq_tail_).store(local_tail_, std::memory_order_release);
+        uint32_t pending = local_tail_ - std::atomic_ref<uint32_t>(*sq_head_).load(std::memory_order_acquire);
+        // EINTR and EAGAIN leave the SQEs queued; they go in with the next call
+        ::syscall(__NR_io_uring_enter, fd_, pending, 1u, IORING_ENTER_GETEVENTS, nullptr, 0);
+    }
+
+    template<typename F>
+    void ForEachCompletion(F&& fn) {
+        std::atomic_ref<uint32_t> head_ref(*cq_head_);
+        uint32_t head = head_ref.load(std::memory_order_relaxed);
+        uint32_t tail = std::atomic_ref<uint32_t>(*cq_tail_).load(std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            uint64_t user_data = cqe.user_data;
+            int32_t result = cqe.res;
+            // Release the slot before running fn, which may queue new work
+            head_ref.store(head + 1, std::memory_order_release);
+            fn(user_data, result);
+        }
+    }
+
+private:
+    void* Map(size_t size, off_t offset) const {
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    int fd_{-1};
+    unsigned entries_{0};
+    void* sq_ring_{nullptr};
+    void* cq_ring_{nullptr};
+    size_t sq_ring_size_{0};
+    size_t cq_ring_size_{0};
+    io_uring_sqe* sqes_{nullptr};
+    size_t sqes_size_{0};
+    uint32_t* sq_head_{nullptr};
+    uint32_t* sq_tail_{nullptr};
+    uint32_t* sq_array_{nullptr};
+    uint32_t sq_mask_{0};
+    uint32_t local_tail_{0};
+    uint32_t* cq_head_{nullptr};
+    uint32_t* cq_tail_{nullptr};
+    uint32_t cq_mask_{0};
+    io_uring_cqe* cqes_{nullptr};
+};
+
+/**
+ * Every request is a chain of kernel operations, one in flight at a time:
+ * open, statx (reads only), read/write until done, close. A single thread
+ * owns the ring; submitters hand requests over through a queue and an
+ * eventfd whose read is always pending in the ring.
+ */
+class IoUringBackend : public IoBackend {
+public:
+    static std::unique_ptr<IoUringBackend> Create(size_t queue_depth) {
+        std::unique_ptr<IoUringBackend> backend(new IoUringBackend());
+        // One extra slot for the eventfd read
+        auto entries = static_cast<unsigned>(std::min<size_t>(queue_depth + 1, 4096));
+        if (!backend->ring_.Init(entries) ||
+            !backend->ring_.SupportsOps({IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ,
+                                         IORING_OP_WRITE, IORING_OP_CLOSE})) {
+            return nullptr;
+        }
+        backend->event_fd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (backend->event_fd_ < 0) {
+            return nullptr;
+        }
+        backend->max_active_ = std::min<size_t>(queue_depth, backend->ring_.Entries() - 1);
+        backend->thread_ = std::thread([raw = backend.get()] { raw->Run(); });
+        return backend;
+    }
+
+    ~IoUringBackend() override {
+        if (thread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            Wake();
+            thread_.join();
+        }
+        if (event_fd_ >= 0) {
+            ::close(event_fd_);
+        }
+    }
+
+    void Submit(std::unique_ptr<IoRequest> request) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            incoming_.push_back(std::move(request));
+        }
+        Wake();
+    }
+
+private:
+    struct Operation {
+        enum class Stage {
+            OPEN,
+            STAT,
+            TRANSFER,
+            CLOSE
+        };
+
+        std::unique_ptr<IoRequest> request;
+        Stage stage{Stage::OPEN};
+        int fd{-1};
+        size_t done{0};
+        bool ok{true};
+        bool streaming{false};  // Size unknown (pipe, /proc file): read until EOF
+        struct statx stat{};
+    };
+
+    static constexpr uint64_t kWakeTag = 0;
+    static constexpr char kEmptyPath[] = "";
+    static constexpr size_t kMaxTransfer = size_t{1} << 30;
+    static constexpr size_t kStreamChunk = size_t{64} << 10;  // First buffer of a streaming read; doubles
+
+    IoUringBackend() = default;
+
+    void Wake() {
+        uint64_t one = 1;
+        if (::write(event_fd_, &one, sizeof(one)) < 0) {
+            // The counter only fails to grow when it is already non-zero, which wakes the ring anyway
+        }
+    }
+
+    void PostWakeRead() {
+        io_uring_sqe* sqe = ring_.NextSqe();
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = event_fd_;
+        sqe->addr = reinterpret_cast<uint64_t>(&wake_value_);
+        sqe->len = sizeof(wake_value_);
+        sqe->user_data = kWakeTag;
+    }
+
+    void Run() {
+        std::deque<std::unique_ptr<IoRequest>> waiting;
+        PostWakeRead();
+        for (;;) {
+            bool stopping = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::move(incoming_.begin(), incoming_.end(), std::back_inserter(waiting));
+                incoming_.clear();
+                stopping = stopping_;
+            }
+            while (active_ < max_active_ && !waiting.empty()) {
+                auto* operation = new Operation{std::move(waiting.front())};
+                waiting.pop_front();
+                ++active_;
+                Prepare(*operation);
+            }
+            if (stopping && active_ == 0 && waiting.empty()) {
+                return;
+            }
+
+            ring_.SubmitAndWait();
+            ring_.ForEachCompletion([this](uint64_t user_data, int32_t result) {
+                if (user_data == kWakeTag) {
+                    PostWakeRead();
+                } else {
+                    Advance(reinterpret_cast<Operation*>(user_data), result);
+                }
+            });
+        }
+    }
+
+    void Prepare(Operation& operation) {
+        auto& request = *operation.request;
+        io_uring_sqe* sqe = ring_.NextSqe();
+        sqe->user_data = reinterpret_cast<uint64_t>(&operation);
+        switch (operation.stage) {
+            case Operation::Stage::OPEN:
+                sqe->opcode = IORING_OP_OPENAT;
+                sqe->fd = AT_FDCWD;
+                sqe->addr = reinterpret_cast<uint64_t>(request.path.c_str());
+                sqe->open_flags = request.kind == IoRequest::Kind::READ
+                    ? O_RDONLY | O_CLOEXEC
+                    : O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+                sqe->len = 0644;
+                break;
+            case Operation::Stage::STAT:
+                sqe->opcode = IORING_OP_STATX;
+                sqe->fd = operation.fd;
+                sqe->addr = reinterpret_cast<uint64_t>(kEmptyPath);
+                sqe->statx_flags = AT_EMPTY_PATH;
+                sqe->len = STATX_TYPE | STATX_SIZE;
+                sqe->off = reinterpret_cast<uint64_t>(&operation.stat);
+                break;
+            case Operation::Stage::TRANSFER:
+                sqe->opcode = request.kind == IoRequest::Kind::READ ? IORING_OP_READ : IORING_OP_WRITE;
+                sqe->fd = operation.fd;
+                sqe->addr = reinterpret_cast<uint64_t>(request.data.data() + operation.done);
+                sqe->len = static_cast<uint32_t>(std::min(request.data.size() - operation.done, kMaxTransfer));
+                // Pipes cannot read at an offset; -1 reads from the file position
+                sqe->off = operation.streaming ? ~uint64_t{0} : operation.done;
+                break;
+            case Operation::Stage::CLOSE:
+                sqe->opcode = IORING_OP_CLOSE;
+                sqe->fd = operation.fd;
+                break;
+        }
+    }
+
+    void Advance(Operation* operation, int32_t result) {
+        auto& request = *operation->request;
+        bool retry = result == -EINTR || result == -EAGAIN;
+        switch (operation->stage) {
+            case Operation::Stage::OPEN:
+                if (retry) {
+                    break;
+                }
+                if (result < 0) {
+                    Finish(operation, false);
+                    return;
+                }
+                operation->fd = result;
+                if (request.kind == IoRequest::Kind::READ) {
+                    operation->stage = Operation::Stage::STAT;
+                } else {
+                    operation->stage = request.data.empty() ? Operation::Stage::CLOSE : Operation::Stage::TRANSFER;
+                }
+                break;
+            case Operation::Stage::STAT:
+                if (retry) {
+                    break;
+                }
+                if (result < 0) {
+                    operation->ok = false;
+                    operation->stage = Operation::Stage::CLOSE;
+                } else if (S_ISREG(operation->stat.stx_mode) && operation->stat.stx_size > 0) {
+                    // Sized once; a file that shrinks meanwhile is cut at the first short read
+                    request.data.resize(static_cast<size_t>(operation->stat.stx_size));
+                    operation->stage = Operation::Stage::TRANSFER;
+                } else {
+                    // No usable size (FIFO, character device, /proc or sysfs file): grow until EOF
+                    operation->streaming = true;
+                    request.data.resize(kStreamChunk);
+                    operation->stage = Operation::Stage::TRANSFER;
+                }
+                break;
+            case Operation::Stage::TRANSFER:
+                if (retry) {
+                    break;
+                }
+                if (result < 0 || (result == 0 && request.kind == IoRequest::Kind::WRITE)) {
+                    operation->ok = false;
+                    operation->stage = Operation::Stage::CLOSE;
+                } else if (result == 0) {
+                    request.data.resize(operation->done);
+                    operation->stage = Operation::Stage::CLOSE;
+                } else {
+                    operation->done += static_cast<size_t>(result);
+                    if (operation->done == request.data.size()) {
+                        if (operation->streaming) {
+                            request.data.resize(request.data.size() * 2);
+                        } else {
+                            operation->stage = Operation::Stage::CLOSE;
+                        }
+                    }
+                }
+                break;
+            case Operation::Stage::CLOSE:
+                // Deferred write errors (e.g. on network file systems) surface at close
+                Finish(operation, operation->ok && (result >= 0 || request.kind == IoRequest::Kind::READ));
+                return;
+        }
+        Prepare(*operation);
+    }
+
+    void Finish(Operation* operation, bool ok) {
+        std::unique_ptr<Operation> owned(operation);
+        --active_;
+        owned->request->Complete(ok);
+    }
+
+    std::mutex mutex_;
+    std::deque<std::unique_ptr<IoRequest>> incoming_;
+    bool stopping_{false};
+
+    uint64_t wake_value_{0};
+    IoUring ring_;  // After wake_value_, which its pending eventfd read targets
+    int event_fd_{-1};
+    size_t max_active_{1};
+    size_t active_{0};
+    std::thread thread_;
+};
+
+#endif // VISION_INFRA_HAS_IO_URING
+
+std::unique_ptr<IoBackend> CreateIoUringBackend(size_t queue_depth) {
+#if VISION_INFRA_HAS_IO_URING
+    return IoUringBackend::Create(queue_depth);
+#else
+    (void)queue_depth;
+    return nullptr;
+#endif
+}
+
+} // namespace
+
+// AsyncFileIO::Impl (PIMPL implementation)
+class AsyncFileIO::Impl {
+public:
+    AsyncIOBackend backend_{AsyncIOBackend::THREAD_POOL};
+    size_t queue_depth_{1};
+    std::unique_ptr<IoBackend> io_;
+};
+
+// AsyncFileIO implementation
+AsyncFileIO::AsyncFileIO(const AsyncIOOptions& options) : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->queue_depth_ = std::max<size_t>(options.queue_depth, 1);
+    if (options.backend != AsyncIOBackend::THREAD_POOL) {
+        pImpl_->io_ = CreateIoUringBackend(pImpl_->queue_depth_);
+        if (pImpl_->io_) {
+            pImpl_->backend_ = AsyncIOBackend::IO_URING;
+        } else if (options.backend == AsyncIOBackend::IO_URING) {
+            throw std::runtime_error("io_uring is not available");
+        }
+    }
+    if (!pImpl_->io_) {
+        pImpl_->io_ = std::make_unique<ThreadPoolBackend>(pImpl_->queue_depth_);
+        pImpl_->backend_ = AsyncIOBackend::THREAD_POOL;
+    }
+}
+
+AsyncFileIO::~AsyncFileIO() = default;
+
+AsyncIOBackend AsyncFileIO::GetBackend() const noexcept {
+    return pImpl_->backend_;
+}
+
+size_t AsyncFileIO::GetQueueDepth() const noexcept {
+    return pImpl_->queue_depth_;
+}
+
+void AsyncFileIO::ReadFile(const std::string& path, ReadCallback callback) {
+    auto request = std::make_unique<IoRequest>();
+    request->kind = IoRequest::Kind::READ;
+    request->path = path;
+    request->on_read = std::move(callback);
+    pImpl_->io_->Submit(std::move(request));
+}
+
+std::future<std::optional<std::vector<uint8_t>>> AsyncFileIO::ReadFile(const std::string& path) {
+    auto promise = std::make_shared<std::promise<std::optional<std::vector<uint8_t>>>>();
+    auto future = promise->get_future();
+    ReadFile(path, [promise](std::optional<std::vector<uint8_t>> content) {
+        promise->set_value(std::move(content));
+    });
+    return future;
+}
+
+void AsyncFileIO::WriteFile(const std::string& path, std::vector<uint8_t> data, WriteCallback callback) {
+    auto request = std::make_unique<IoRequest>();
+    request->kind = IoRequest::Kind::WRITE;
+    request->path = path;
+    request->data = std::move(data);
+    request->on_write = std::move(callback);
+    pImpl_->io_->Submit(std::move(request));
+}
+
+std::future<bool> AsyncFileIO::WriteFile(const std::string& path, std::vector<uint8_t> data) {
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future = promise->get_future();
+    WriteFile(path, std::move(data), [promise](bool ok) { promise->set_value(ok); });
+    return future;
+}
+
+bool AsyncFileIO::IsIoUringAvailable() {
+    static const bool available = CreateIoUringBackend(1) != nullptr;
+    return available;
+}
+
+std::shared_ptr<AsyncFileIO> AsyncFileIO::GetDefault() {
+    static auto engine = std::make_shared<AsyncFileIO>();
+    return engine;
+}
+
+} // namespace core
+} // namespace vision_infra
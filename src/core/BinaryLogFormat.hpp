@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * On-disk layout shared by BinaryLogSink and BinaryLogReader.
+ *
+ * File:    magic[8] version:u32 reserved:u32, then records
+ * Record:  type:u8 followed by
+ *   FORMAT / LOGGER:  id:u32 length:u32 bytes[length]
+ *   EVENT:            level:u8 arg_count:u8 logger_id:u32 format_id:u32
+ *                     time_ns:i64 thread_id:u64 payload_size:u32 payload[payload_size]
+ * A zero type byte marks the end of the written records.
+ */
+namespace binlog {
+
+constexpr char kMagic[8] = {'V', 'I', 'B', 'L', 'O', 'G', '\0', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kFileHeaderSize = sizeof(kMagic) + 2 * sizeof(uint32_t);
+constexpr size_t kDefinitionHeaderSize = 2 * sizeof(uint32_t);
+constexpr size_t kEventHeaderSize = 2 + 2 * sizeof(uint32_t) + sizeof(int64_t) + sizeof(uint64_t) + sizeof(uint32_t);
+
+enum class RecordType : uint8_t {
+    END = 0,
+    FORMAT = 1,
+    LOGGER = 2,
+    EVENT = 3
+};
+
+template<typename T>
+char* Put(char* out, const T& value) {
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+template<typename T>
+const char* Get(const char* in, T& value) {
+    std::memcpy(&value, in, sizeof(T));
+    return in + sizeof(T);
+}
+
+} // namespace binlog
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,222 @@
+#include "vision-infra/core/BinaryLogReader.hpp"
+#include "BinaryLogFormat.hpp"
+#include "LogRecord.hpp"
+#include "PatternFormatter.hpp"
+#include <fstream>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+using DecodedArg = std::variant<int64_t, uint64_t, double, bool, char, std::string_view, const void*>;
+
+detail::FormatArg MakeDecodedFormatArg(const DecodedArg& arg) {
+    return {&arg, [](std::string& out, const void* ptr, const detail::FormatSpec& spec) {
+                std::visit([&](const auto& value) { detail::AppendValue(out, value, spec); },
+                           *static_cast<const DecodedArg*>(ptr));
+            }};
+}
+
+} // namespace
+
+// BinaryLogReader::Impl (PIMPL implementation)
+class BinaryLogReader::Impl {
+public:
+    std::string data_;
+    size_t offset_{0};
+    std::vector<std::string_view> formats_;
+    std::vector<std::string_view> loggers_;
+    std::vector<DecodedArg> args_;
+    std::vector<detail::FormatArg> format_args_;
+    PatternFormatter formatter_;
+
+    bool Available(size_t bytes) const { return data_.size() - offset_ >= bytes; }
+
+    // Returns false when the definition is truncated
+    bool ReadDefinition(std::vector<std::string_view>& table) {
+        if (!Available(binlog::kDefinitionHeaderSize)) {
+            return false;
+        }
+        uint32_t id = 0;
+        uint32_t length = 0;
+        const char* in = binlog::Get(data_.data() + offset_, id);
+        binlog::Get(in, length);
+        if (!Available(binlog::kDefinitionHeaderSize + length)) {
+            return false;
+        }
+        if (table.size() <= id) {
+            table.resize(id + 1);
+        }
+        table[id] = std::string_view(data_).substr(offset_ + binlog::kDefinitionHeaderSize, length);
+        offset_ += binlog::kDefinitionHeaderSize + length;
+        return true;
+    }
+
+    void DecodeArgs(const char* in, const char* end, uint8_t count) {
+        args_.clear();
+        for (uint8_t i = 0; i < count; ++i) {
+            if (in >= end) {
+                throw std::runtime_error("Corrupt binary log arguments");
+            }
+            auto type = static_cast<BinaryArgType>(*in++);
+            auto need = [&](size_t bytes) {
+                if (static_cast<size_t>(end - in) < bytes) {
+                    throw std::runtime_error("Corrupt binary log arguments");
+                }
+            };
+            switch (type) {
+                case BinaryArgType::INT64: {
+                    int64_t value = 0;
+                    need(sizeof(value));
+                    in = binlog::Get(in, value);
+                    args_.emplace_back(value);
+                    break;
+                }
+                case BinaryArgType::UINT64: {
+                    uint64_t value = 0;
+                    need(sizeof(value));
+                    in = binlog::Get(in, value);
+                    args_.emplace_back(value);
+                    break;
+                }
+                case BinaryArgType::DOUBLE: {
+                    double value = 0;
+                    need(sizeof(value));
+                    in = binlog::Get(in, value);
+                    args_.emplace_back(value);
+                    break;
+                }
+                case BinaryArgType::BOOL:
+                    need(1);
+                    args_.emplace_back(*in++ != 0);
+                    break;
+                case BinaryArgType::CHAR:
+                    need(1);
+                    args_.emplace_back(*in++);
+                    break;
+                case BinaryArgType::STRING: {
+                    uint32_t length = 0;
+                    need(sizeof(length));
+                    in = binlog::Get(in, length);
+                    need(length);
+                    args_.emplace_back(std::string_view(in, length));
+                    in += length;
+                    break;
+                }
+                case BinaryArgType::POINTER: {
+                    uint64_t value = 0;
+                    need(sizeof(value));
+                    in = binlog::Get(in, value);
+                    args_.emplace_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(value)));
+                    break;
+                }
+                default:
+                    throw std::runtime_error("Unknown binary log argument type");
+            }
+        }
+    }
+};
+
+// BinaryLogReader implementation
+BinaryLogReader::BinaryLogReader(const std::string& path) : pImpl_(std::make_unique<Impl>()) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Cannot open binary log: " + path);
+    }
+    pImpl_->data_.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(pImpl_->data_.data(), static_cast<std::streamsize>(pImpl_->data_.size()));
+
+    const auto& data = pImpl_->data_;
+    uint32_t version = 0;
+    if (data.size() < binlog::kFileHeaderSize ||
+        std::string_view(data).substr(0, sizeof(binlog::kMagic)) !=
+            std::string_view(binlog::kMagic, sizeof(binlog::kMagic))) {
+        throw std::runtime_error("Not a binary log: " + path);
+    }
+    binlog::Get(data.data() + sizeof(binlog::kMagic), version);
+    if (version != binlog::kVersion) {
+        throw std::runtime_error("Unsupported binary log version in " + path);
+    }
+    pImpl_->offset_ = binlog::kFileHeaderSize;
+}
+
+BinaryLogReader::~BinaryLogReader() = default;
+
+bool BinaryLogReader::Next(BinaryLogEntry& entry) {
+    auto& impl = *pImpl_;
+    while (impl.Available(1)) {
+        auto type = static_cast<binlog::RecordType>(impl.data_[impl.offset_]);
+        switch (type) {
+            case binlog::RecordType::END:
+                return false;
+            case binlog::RecordType::FORMAT:
+            case binlog::RecordType::LOGGER:
+                ++impl.offset_;
+                if (!impl.ReadDefinition(type == binlog::RecordType::FORMAT ? impl.formats_ : impl.loggers_)) {
+                    return false;
+                }
+                break;
+            case binlog::RecordType::EVENT: {
+                if (!impl.Available(1 + binlog::kEventHeaderSize)) {
+                    return false;
+                }
+                uint8_t level = 0;
+                uint8_t arg_count = 0;
+                uint32_t logger_id = 0;
+                uint32_t format_id = 0;
+                int64_t time_ns = 0;
+                uint32_t payload_size = 0;
+                const char* in = impl.data_.data() + impl.offset_ + 1;
+                in = binlog::Get(in, level);
+                in = binlog::Get(in, arg_count);
+                in = binlog::Get(in, logger_id);
+                in = binlog::Get(in, format_id);
+                in = binlog::Get(in, time_ns);
+                in = binlog::Get(in, entry.thread_id);
+                in = binlog::Get(in, payload_size);
+                if (!impl.Available(1 + binlog::kEventHeaderSize + payload_size)) {
+                    return false;
+                }
+                if (format_id >= impl.formats_.size() || logger_id >= impl.loggers_.size()) {
+                    throw std::runtime_error("Binary log record references an unknown id");
+                }
+                impl.offset_ += 1 + binlog::kEventHeaderSize + payload_size;
+
+                impl.DecodeArgs(in, in + payload_size, arg_count);
+                impl.format_args_.clear();
+                for (const auto& arg : impl.args_) {
+                    impl.format_args_.push_back(MakeDecodedFormatArg(arg));
+                }
+
+                entry.level = static_cast<LogLevel>(level);
+                entry.time = std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(time_ns)));
+                entry.logger_name = impl.loggers_[logger_id];
+                entry.format = impl.formats_[format_id];
+                entry.message.clear();
+                detail::VFormatTo(entry.message, entry.format, impl.format_args_.data(), impl.format_args_.size());
+                return true;
+            }
+            default:
+                throw std::runtime_error("Corrupt binary log record");
+        }
+    }
+    return false;
+}
+
+void BinaryLogReader::SetPattern(const std::string& pattern) {
+    pImpl_->formatter_.SetPattern(pattern);
+}
+
+void BinaryLogReader::FormatEntry(const BinaryLogEntry& entry, std::string& out) const {
+    LogRecord record{entry.level, entry.time, entry.thread_id, std::source_location(), {}};
+    pImpl_->formatter_.Format(record, entry.message, entry.logger_name, out);
+}
+
+} // namespace core
+} // namespace vision_infra
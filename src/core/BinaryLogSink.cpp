@@ -0,0 +1,194 @@
+#include "vision-infra/core/BinaryLogSink.hpp"
+#include "vision-infra/core/Logger.hpp"
+#include "BinaryLogFormat.hpp"
+#include "LogRecord.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+// Format strings are literals, so their address and length identify them
+struct FormatKeyHash {
+    size_t operator()(const std::pair<const char*, size_t>& key) const noexcept {
+        return std::hash<const char*>{}(key.first) ^ (key.second * 0x9e3779b97f4a7c15ULL);
+    }
+};
+
+} // namespace
+
+// BinaryLogSink::Impl (PIMPL implementation)
+class BinaryLogSink::Impl {
+public:
+    std::string path_;
+    int fd_{-1};
+    char* data_{nullptr};
+    size_t capacity_{0};
+    size_t size_{0};
+    std::mutex mutex_;
+    std::unordered_map<std::pair<const char*, size_t>, uint32_t, FormatKeyHash> format_ids_;
+    std::unordered_map<std::string, uint32_t> logger_ids_;
+
+#ifndef _WIN32
+    void Map(size_t capacity) {
+        if (::ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+            throw std::runtime_error("Cannot grow binary log: " + path_);
+        }
+        void* mapped = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapped == MAP_FAILED) {
+            throw std::runtime_error("Cannot map binary log: " + path_);
+        }
+        data_ = static_cast<char*>(mapped);
+        capacity_ = capacity;
+    }
+
+    void Unmap() {
+        if (data_) {
+            ::munmap(data_, capacity_);
+            data_ = nullptr;
+        }
+    }
+#endif
+
+    // Caller holds mutex_; returns space for bytes more bytes
+    char* Reserve(size_t bytes) {
+#ifndef _WIN32
+        // Keep one byte free for the END marker
+        if (size_ + bytes + 1 > capacity_) {
+            size_t capacity = capacity_;
+            while (size_ + bytes + 1 > capacity) {
+                capacity *= 2;
+            }
+            Unmap();
+            Map(capacity);
+        }
+#endif
+        return data_ + size_;
+    }
+
+    // The type byte is stored after the body, so a record interrupted by a
+    // crash still reads as the end of the log. Caller holds mutex_.
+    void Commit(char* record, size_t bytes, binlog::RecordType type) {
+        *record = static_cast<char>(type);
+        size_ += bytes;
+    }
+
+    // Caller holds mutex_
+    void WriteDefinition(binlog::RecordType type, uint32_t id, std::string_view text) {
+        size_t bytes = 1 + binlog::kDefinitionHeaderSize + text.size();
+        char* record = Reserve(bytes);
+        char* out = binlog::Put(record + 1, id);
+        out = binlog::Put(out, static_cast<uint32_t>(text.size()));
+        std::memcpy(out, text.data(), text.size());
+        Commit(record, bytes, type);
+    }
+};
+
+// BinaryLogSink implementation
+BinaryLogSink::BinaryLogSink(const std::string& path, const BinaryLogOptions& options)
+    : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->path_ = path;
+#ifdef _WIN32
+    (void)options;
+    throw std::runtime_error("BinaryLogSink requires POSIX memory mapping");
+#else
+    pImpl_->fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (pImpl_->fd_ < 0) {
+        throw std::runtime_error("Cannot open binary log: " + path);
+    }
+    try {
+        pImpl_->Map(std::max(options.initial_size, size_t{4096}));
+    } catch (...) {
+        ::close(pImpl_->fd_);
+        throw;
+    }
+
+    char* out = binlog::Put(pImpl_->data_, binlog::kMagic);
+    out = binlog::Put(out, binlog::kVersion);
+    binlog::Put(out, uint32_t{0});
+    pImpl_->size_ = binlog::kFileHeaderSize;
+#endif
+}
+
+BinaryLogSink::~BinaryLogSink() {
+#ifndef _WIN32
+    // Trim the preallocated tail, keeping one zero byte as the END marker
+    pImpl_->Unmap();
+    if (::ftruncate(pImpl_->fd_, static_cast<off_t>(pImpl_->size_ + 1)) != 0) {
+        // The untrimmed tail is zero-filled and decodes as the end of the log
+    }
+    ::close(pImpl_->fd_);
+#endif
+}
+
+uint32_t BinaryLogSink::RegisterLogger(std::string_view name) {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    auto [it, inserted] = pImpl_->logger_ids_.try_emplace(std::string(name),
+                                                          static_cast<uint32_t>(pImpl_->logger_ids_.size()));
+    if (inserted) {
+        pImpl_->WriteDefinition(binlog::RecordType::LOGGER, it->second, name);
+    }
+    return it->second;
+}
+
+void BinaryLogSink::WriteMessage(LogLevel level, uint32_t logger_id, std::string_view message) {
+    Write(level, logger_id, "{}", message);
+}
+
+void BinaryLogSink::WriteEvent(LogLevel level, uint32_t logger_id, std::string_view format,
+                               std::string_view payload, uint8_t arg_count) {
+    const auto time_ns = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    const uint64_t thread_id = CurrentThreadId();
+
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    auto [it, inserted] = pImpl_->format_ids_.try_emplace({format.data(), format.size()},
+                                                          static_cast<uint32_t>(pImpl_->format_ids_.size()));
+    if (inserted) {
+        pImpl_->WriteDefinition(binlog::RecordType::FORMAT, it->second, format);
+    }
+
+    size_t bytes = 1 + binlog::kEventHeaderSize + payload.size();
+    char* record = pImpl_->Reserve(bytes);
+    char* out = binlog::Put(record + 1, static_cast<uint8_t>(level));
+    out = binlog::Put(out, arg_count);
+    out = binlog::Put(out, logger_id);
+    out = binlog::Put(out, it->second);
+    out = binlog::Put(out, time_ns);
+    out = binlog::Put(out, thread_id);
+    out = binlog::Put(out, static_cast<uint32_t>(payload.size()));
+    std::memcpy(out, payload.data(), payload.size());
+    pImpl_->Commit(record, bytes, binlog::RecordType::EVENT);
+}
+
+void BinaryLogSink::Flush() {
+#ifndef _WIN32
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    ::msync(pImpl_->data_, pImpl_->size_, MS_SYNC);
+#endif
+}
+
+const std::string& BinaryLogSink::GetPath() const noexcept {
+    return pImpl_->path_;
+}
+
+uint64_t BinaryLogSink::GetBytesWritten() const noexcept {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->size_;
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,263 @@
+#include "vision-infra/core/DirectoryScanner.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+using ScanCallback = std::function<void(const ScanEntry&)>;
+
+/**
+ * Shared state of one walk: a stack of directories still to be listed and
+ * the number of directories queued or being listed. Workers exit once that
+ * count drops to zero, or as soon as the walk is stopped.
+ */
+class Walk {
+public:
+    Walk(const ScanOptions& options, const ScanCallback& callback, const std::atomic<bool>* cancel)
+        : options_(options), callback_(callback), cancel_(cancel) {
+        if (options.media_types.empty()) {
+            std::fill(std::begin(accept_), std::end(accept_), true);
+        }
+        for (auto type : options.media_types) {
+            accept_[static_cast<size_t>(type)] = true;
+        }
+    }
+
+    void Push(std::filesystem::path directory) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            directories_.push_back(std::move(directory));
+            ++pending_;
+        }
+        cv_.notify_one();
+    }
+
+    void Work() {
+        for (;;) {
+            std::filesystem::path directory;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return !directories_.empty() || pending_ == 0 || stopped_; });
+                if (stopped_ || directories_.empty()) {
+                    return;
+                }
+                directory = std::move(directories_.back());
+                directories_.pop_back();
+            }
+
+            try {
+                List(directory);
+            } catch (...) {
+                Stop();
+                throw;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                cv_.notify_all();
+            }
+        }
+    }
+
+    size_t Count() const noexcept {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void List(const std::filesystem::path& directory) {
+        std::error_code ec;
+        std::filesystem::directory_iterator it(directory, std::filesystem::directory_options::skip_permission_denied, ec);
+        for (; !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+            if (cancel_ && cancel_->load(std::memory_order_relaxed)) {
+                Stop();
+                return;
+            }
+
+            // Types come from the directory listing itself where the OS provides them
+            const auto& entry = *it;
+            std::error_code type_ec;
+            if (entry.is_directory(type_ec)) {
+                if (options_.recursive && (options_.follow_symlinks || !entry.is_symlink(type_ec))) {
+                    Push(entry.path());
+                }
+                continue;
+            }
+            if (!entry.is_regular_file(type_ec)) {
+                continue;
+            }
+
+            auto path = entry.path().string();
+            auto type = FileSystemUtils::GetMediaType(path);
+            if (!accept_[static_cast<size_t>(type)]) {
+                continue;
+            }
+            callback_(ScanEntry{std::move(path), type});
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    const ScanOptions& options_;
+    const ScanCallback& callback_;
+    const std::atomic<bool>* cancel_;
+    bool accept_[static_cast<size_t>(MediaType::MODEL) + 1]{};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::filesystem::path> directories_;
+    size_t pending_{0};
+    bool stopped_{false};
+    std::atomic<size_t> count_{0};
+};
+
+size_t RunWalk(const ScanOptions& options, const std::string& root, const ScanCallback& callback,
+               ThreadPool* pool, const std::atomic<bool>* cancel) {
+    Walk walk(options, callback, cancel);
+    walk.Push(root);
+    if (pool) {
+        // One extra worker for the calling thread, which ParallelFor also runs on
+        pool->ParallelFor(0, pool->GetNumThreads() + 1, [&walk](size_t) { walk.Work(); });
+    } else {
+        walk.Work();
+    }
+    return walk.Count();
+}
+
+std::vector<std::string> CollectPaths(const ScanOptions& options, const std::string& root, ThreadPool* pool) {
+    std::mutex mutex;
+    std::vector<std::string> paths;
+    RunWalk(options, root, [&](const ScanEntry& entry) {
+        std::lock_guard<std::mutex> lock(mutex);
+        paths.push_back(entry.path);
+    }, pool, nullptr);
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+} // namespace
+
+// ScanStream::Impl (PIMPL implementation)
+class ScanStream::Impl {
+public:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<ScanEntry> entries_;
+    size_t capacity_{1};
+    bool done_{false};
+    std::exception_ptr error_;
+    std::atomic<bool> cancel_{false};
+    std::future<void> producer_;
+
+    void Push(const ScanEntry& entry) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] {
+            return entries_.size() < capacity_ || cancel_.load(std::memory_order_relaxed);
+        });
+        if (cancel_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        entries_.push_back(entry);
+        not_empty_.notify_one();
+    }
+
+    void Finish(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+            error_ = std::move(error);
+        }
+        not_empty_.notify_all();
+    }
+};
+
+// DirectoryScanner implementation
+DirectoryScanner::DirectoryScanner(ScanOptions options) : options_(std::move(options)) {}
+
+size_t DirectoryScanner::Scan(const std::string& root, const std::function<void(const ScanEntry&)>& callback) const {
+    return RunWalk(options_, root, callback, nullptr, nullptr);
+}
+
+size_t DirectoryScanner::Scan(const std::string& root, const std::function<void(const ScanEntry&)>& callback,
+                              ThreadPool& pool) const {
+    return RunWalk(options_, root, callback, &pool, nullptr);
+}
+
+std::vector<std::string> DirectoryScanner::ScanAll(const std::string& root) const {
+    return CollectPaths(options_, root, nullptr);
+}
+
+std::vector<std::string> DirectoryScanner::ScanAll(const std::string& root, ThreadPool& pool) const {
+    return CollectPaths(options_, root, &pool);
+}
+
+std::unique_ptr<ScanStream> DirectoryScanner::Stream(const std::string& root, ThreadPool& pool, size_t capacity) const {
+    std::unique_ptr<ScanStream> stream(new ScanStream());
+    // The stream's destructor waits for the producer, so the raw pointer stays valid
+    auto* impl = stream->pImpl_.get();
+    impl->capacity_ = std::max<size_t>(capacity, 1);
+    impl->producer_ = pool.Submit([impl, options = options_, root, &pool] {
+        try {
+            RunWalk(options, root, [impl](const ScanEntry& entry) { impl->Push(entry); }, &pool, &impl->cancel_);
+            impl->Finish(nullptr);
+        } catch (...) {
+            impl->Finish(std::current_exception());
+        }
+    });
+    return stream;
+}
+
+const ScanOptions& DirectoryScanner::GetOptions() const noexcept {
+    return options_;
+}
+
+// ScanStream implementation
+ScanStream::ScanStream() : pImpl_(std::make_unique<Impl>()) {}
+
+ScanStream::~ScanStream() {
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+        pImpl_->cancel_.store(true, std::memory_order_relaxed);
+    }
+    pImpl_->not_full_.notify_all();
+    if (pImpl_->producer_.valid()) {
+        pImpl_->producer_.wait();
+    }
+}
+
+bool ScanStream::Next(ScanEntry& entry) {
+    auto& impl = *pImpl_;
+    std::unique_lock<std::mutex> lock(impl.mutex_);
+    impl.not_empty_.wait(lock, [&impl] { return !impl.entries_.empty() || impl.done_; });
+    if (!impl.entries_.empty()) {
+        entry = std::move(impl.entries_.front());
+        impl.entries_.pop_front();
+        impl.not_full_.notify_one();
+        return true;
+    }
+    if (impl.error_) {
+        std::rethrow_exception(std::exchange(impl.error_, nullptr));
+    }
+    return false;
+}
+
+} // namespace core
+} // namespace vision_infra
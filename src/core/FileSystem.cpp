@@ -1,13 +1,87 @@
 #include "vision-infra/core/FileSystem.hpp"
+#include "vision-infra/core/Profiler.hpp"
 #include <filesystem>
 #include <fstream>
-#include <set>
 #include <algorithm>
+#include <utility>
 
 namespace vision_infra {
 namespace core {
 
+namespace {
+
+constexpr size_t kReadChunkSize = 64 * 1024;
+
+// Reads a regular file with one read into a buffer sized from the file size;
+// the chunked loop only runs for files whose size is not known up front
+template<typename Buffer>
+std::optional<Buffer> ReadWholeFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    
+    std::error_code ec;
+    auto expected = std::filesystem::file_size(path, ec);
+    Buffer buffer;
+    buffer.resize(ec ? 0 : static_cast<size_t>(expected));
+    
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    auto total = static_cast<size_t>(file.gcount());
+    if (total == buffer.size() && file.peek() != std::ifstream::traits_type::eof()) {
+        while (file) {
+            buffer.resize(total + kReadChunkSize);
+            file.read(reinterpret_cast<char*>(buffer.data() + total), static_cast<std::streamsize>(kReadChunkSize));
+            total += static_cast<size_t>(file.gcount());
+        }
+    }
+    if (file.bad()) {
+        return std::nullopt;
+    }
+    buffer.resize(total);
+    return buffer;
+}
+
+template<typename T>
+std::future<T> ReadyFuture(T value) {
+    std::promise<T> promise;
+    promise.set_value(std::move(value));
+    return promise.get_future();
+}
+
+} // namespace
+
+// IFileSystem default implementations, built on ReadFile and WriteFile so that
+// existing implementations keep working
+std::optional<std::vector<uint8_t>> IFileSystem::ReadBinaryFile(const std::string& path) const {
+    auto content = ReadFile(path);
+    if (!content) {
+        return std::nullopt;
+    }
+    return std::vector<uint8_t>(content->begin(), content->end());
+}
+
+bool IFileSystem::WriteBinaryFile(const std::string& path, std::span<const uint8_t> data,
+                                  const FileWriteOptions& options) const {
+    std::string content;
+    if (options.append) {
+        content = ReadFile(path).value_or(std::string());
+    }
+    content.append(reinterpret_cast<const char*>(data.data()), data.size());
+    return WriteFile(path, content);
+}
+
+std::future<std::optional<std::vector<uint8_t>>> IFileSystem::ReadFileAsync(const std::string& path) const {
+    return ReadyFuture(ReadBinaryFile(path));
+}
+
+std::future<bool> IFileSystem::WriteFileAsync(const std::string& path, std::vector<uint8_t> data) const {
+    return ReadyFuture(WriteBinaryFile(path, data));
+}
+
 // FileSystem implementation
+FileSystem::FileSystem(std::shared_ptr<AsyncFileIO> async_io) : async_io_(std::move(async_io)) {}
+
 bool FileSystem::Exists(const std::string& path) const {
     std::error_code ec;
     return std::filesystem::exists(path, ec);
@@ -44,28 +118,54 @@ bool FileSystem::RemoveAll(const std::string& path) const {
 }
 
 std::optional<std::string> FileSystem::ReadFile(const std::string& path) const {
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        return std::nullopt;
-    }
-    
-    std::string content;
-    std::string line;
-    while (std::getline(file, line)) {
-        content += line + "\n";
-    }
-    
-    return content;
+    PROFILE_ZONE("io.read");
+    return ReadWholeFile<std::string>(path);
+}
+
+std::optional<std::vector<uint8_t>> FileSystem::ReadBinaryFile(const std::string& path) const {
+    PROFILE_ZONE("io.read");
+    return ReadWholeFile<std::vector<uint8_t>>(path);
+}
+
+std::optional<MappedFile> FileSystem::MapFile(const std::string& path, MappedFile::AccessHint hint) const {
+    return MappedFile::Open(path, hint);
 }
 
 bool FileSystem::WriteFile(const std::string& path, const std::string& content) const {
-    std::ofstream file(path);
-    if (!file.is_open()) {
+    return WriteBinaryFile(path, std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+}
+
+bool FileSystem::WriteBinaryFile(const std::string& path, std::span<const uint8_t> data,
+                                 const FileWriteOptions& options) const {
+    PROFILE_ZONE("io.write");
+    // A single write of the whole payload; no point staging it in the writer's buffer
+    FileWriteOptions direct = options;
+    direct.buffer_size = 0;
+    auto writer = FileWriter::Open(path, direct);
+    if (!writer) {
         return false;
     }
-    
-    file << content;
-    return file.good();
+    return writer->Write(data) && writer->Commit();
+}
+
+std::optional<FileWriter> FileSystem::OpenWriter(const std::string& path, const FileWriteOptions& options) const {
+    return FileWriter::Open(path, options);
+}
+
+std::future<std::optional<std::vector<uint8_t>>> FileSystem::ReadFileAsync(const std::string& path) const {
+    return GetAsyncIO().ReadFile(path);
+}
+
+std::future<bool> FileSystem::WriteFileAsync(const std::string& path, std::vector<uint8_t> data) const {
+    return GetAsyncIO().WriteFile(path, std::move(data));
+}
+
+AsyncFileIO& FileSystem::GetAsyncIO() const {
+    if (async_io_) {
+        return *async_io_;
+    }
+    // The default engine lives for the whole process, so the reference stays valid
+    return *AsyncFileIO::GetDefault();
 }
 
 std::vector<std::string> FileSystem::ListFiles(const std::string& directory) const {
@@ -155,73 +255,32 @@ void FileSystemUtils::SetDefault(std::shared_ptr<IFileSystem> fs) {
     default_file_system_ = fs;
 }
 
-bool FileSystemUtils::IsImageFile(const std::string& filename) {
-    static const std::set<std::string> image_extensions = {
-        ".jpg", ".jpeg", ".png", ".bmp", ".gif", ".tiff", ".tif", ".webp", 
-        ".ico", ".ppm", ".pgm", ".pbm", ".sr", ".ras", ".jp2"
-    };
-    
-    auto fs = GetDefault();
-    auto ext = fs->GetFileExtension(filename);
-    if (!ext.has_value()) {
-        return false;
-    }
-    
-    std::string extension = ext.value();
-    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-    
-    return image_extensions.find(extension) != image_extensions.end();
+bool FileSystemUtils::IsImageFile(std::string_view filename) {
+    return ClassifyPath(filename) == MediaType::IMAGE;
 }
 
-bool FileSystemUtils::IsVideoFile(const std::string& filename) {
-    static const std::set<std::string> video_extensions = {
-        ".mp4", ".avi", ".mkv", ".mov", ".wmv", ".flv", ".webm", ".m4v", 
-        ".3gp", ".3g2", ".mxf", ".roq", ".nsv", ".f4v", ".f4p", ".f4a", ".f4b"
-    };
-    
-    auto fs = GetDefault();
-    auto ext = fs->GetFileExtension(filename);
-    if (!ext.has_value()) {
-        return false;
-    }
-    
-    std::string extension = ext.value();
-    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-    
-    return video_extensions.find(extension) != video_extensions.end();
+bool FileSystemUtils::IsVideoFile(std::string_view filename) {
+    return ClassifyPath(filename) == MediaType::VIDEO;
 }
 
-bool FileSystemUtils::IsModelFile(const std::string& filename) {
-    static const std::set<std::string> model_extensions = {
-        ".onnx", ".pb", ".trt", ".engine", ".plan", ".pth", ".pt", ".h5", 
-        ".savedmodel", ".tflite", ".mlmodel", ".bin", ".caffemodel", ".prototxt"
-    };
-    
-    auto fs = GetDefault();
-    auto ext = fs->GetFileExtension(filename);
-    if (!ext.has_value()) {
-        return false;
-    }
-    
-    std::string extension = ext.value();
-    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-    
-    return model_extensions.find(extension) != model_extensions.end();
+bool FileSystemUtils::IsModelFile(std::string_view filename) {
+    return ClassifyPath(filename) == MediaType::MODEL;
+}
+
+MediaType FileSystemUtils::GetMediaType(std::string_view filename) {
+    return ClassifyPath(filename);
 }
 
-std::vector<std::string> FileSystemUtils::GetSupportedImageExtensions() {
-    return {".jpg", ".jpeg", ".png", ".bmp", ".gif", ".tiff", ".tif", ".webp", 
-            ".ico", ".ppm", ".pgm", ".pbm", ".sr", ".ras", ".jp2"};
+std::span<const std::string_view> FileSystemUtils::GetSupportedImageExtensions() {
+    return detail::kImageExtensions;
 }
 
-std::vector<std::string> FileSystemUtils::GetSupportedVideoExtensions() {
-    return {".mp4", ".avi", ".mkv", ".mov", ".wmv", ".flv", ".webm", ".m4v", 
-            ".3gp", ".3g2", ".mxf", ".roq", ".nsv", ".f4v", ".f4p", ".f4a", ".f4b"};
+std::span<const std::string_view> FileSystemUtils::GetSupportedVideoExtensions() {
+    return detail::kVideoExtensions;
 }
 
-std::vector<std::string> FileSystemUtils::GetSupportedModelExtensions() {
-    return {".onnx", ".pb", ".trt", ".engine", ".plan", ".pth", ".pt", ".h5", 
-            ".savedmodel", ".tflite", ".mlmodel", ".bin", ".caffemodel", ".prototxt"};
+std::span<const std::string_view> FileSystemUtils::GetSupportedModelExtensions() {
+    return detail::kModelExtensions;
 }
 
 } // namespace core
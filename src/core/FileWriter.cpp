@@ -0,0 +1,228 @@
+#include "vision-infra/core/FileWriter.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+bool SyncFile(std::FILE* file) {
+#ifndef _WIN32
+    return ::fsync(::fileno(file)) == 0;
+#else
+    return ::_commit(::_fileno(file)) == 0;
+#endif
+}
+
+// Persist the rename itself; without this the new directory entry can be lost on power failure
+void SyncParentDirectory(const std::string& path) {
+#ifndef _WIN32
+    auto parent = std::filesystem::path(path).parent_path();
+    int fd = ::open(parent.empty() ? "." : parent.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+std::string MakeTempPath(const std::string& path) {
+    static std::atomic<uint64_t> counter{0};
+    auto stamp = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return path + ".tmp." + std::to_string(stamp) + "." + std::to_string(counter.fetch_add(1));
+}
+
+} // namespace
+
+FileWriter::~FileWriter() {
+    if (!temp_path_.empty()) {
+        Abort();
+    } else if (file_) {
+        Commit();
+    }
+}
+
+FileWriter::FileWriter(FileWriter&& other) noexcept
+    : file_(std::exchange(other.file_, nullptr)),
+      path_(std::move(other.path_)),
+      temp_path_(std::move(other.temp_path_)),
+      sync_(other.sync_),
+      good_(other.good_),
+      bytes_written_(std::exchange(other.bytes_written_, 0)),
+      buffer_(std::move(other.buffer_)),
+      buffer_capacity_(std::exchange(other.buffer_capacity_, 0)),
+      buffer_used_(std::exchange(other.buffer_used_, 0)),
+      buffer_charge_(std::move(other.buffer_charge_)) {
+    other.Reset();
+}
+
+FileWriter& FileWriter::operator=(FileWriter&& other) noexcept {
+    if (this != &other) {
+        if (!temp_path_.empty()) {
+            Abort();
+        } else if (file_) {
+            Commit();
+        }
+        file_ = std::exchange(other.file_, nullptr);
+        path_ = std::move(other.path_);
+        temp_path_ = std::move(other.temp_path_);
+        sync_ = other.sync_;
+        good_ = other.good_;
+        bytes_written_ = std::exchange(other.bytes_written_, 0);
+        buffer_ = std::move(other.buffer_);
+        buffer_capacity_ = std::exchange(other.buffer_capacity_, 0);
+        buffer_used_ = std::exchange(other.buffer_used_, 0);
+        buffer_charge_ = std::move(other.buffer_charge_);
+        other.Reset();
+    }
+    return *this;
+}
+
+std::optional<FileWriter> FileWriter::Open(const std::string& path, const FileWriteOptions& options) {
+    if (options.append && options.atomic) {
+        return std::nullopt;
+    }
+
+    FileWriter writer;
+    writer.path_ = path;
+    writer.sync_ = options.sync || options.atomic;
+    if (options.atomic) {
+        writer.temp_path_ = MakeTempPath(path);
+        // "x" fails instead of clobbering a temporary file that happens to exist
+        writer.file_ = std::fopen(writer.temp_path_.c_str(), "wbx");
+    } else {
+        writer.file_ = std::fopen(path.c_str(), options.append ? "ab" : "wb");
+    }
+    if (!writer.file_) {
+        writer.temp_path_.clear();
+        return std::nullopt;
+    }
+
+    // The writer does its own buffering; stdio only sees large writes
+    std::setvbuf(writer.file_, nullptr, _IONBF, 0);
+    writer.buffer_capacity_ = options.buffer_size;
+    if (writer.buffer_capacity_ > 0) {
+        writer.buffer_ = std::make_unique<uint8_t[]>(writer.buffer_capacity_);
+        writer.buffer_charge_ = MemoryCharge(MemoryTag::IO);
+        writer.buffer_charge_.Allocate(writer.buffer_capacity_);
+    }
+    return writer;
+}
+
+bool FileWriter::Write(std::span<const uint8_t> data) {
+    if (!file_ || !good_) {
+        return false;
+    }
+
+    if (buffer_used_ + data.size() > buffer_capacity_) {
+        if (!Flush()) {
+            return false;
+        }
+    }
+    if (data.size() >= buffer_capacity_) {
+        if (!WriteRaw(data.data(), data.size())) {
+            return false;
+        }
+    } else {
+        std::memcpy(buffer_.get() + buffer_used_, data.data(), data.size());
+        buffer_used_ += data.size();
+    }
+    bytes_written_ += data.size();
+    return true;
+}
+
+bool FileWriter::Write(std::string_view data) {
+    return Write(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(data.data()), data.size()));
+}
+
+bool FileWriter::Flush() {
+    if (!file_ || !good_) {
+        return false;
+    }
+    if (buffer_used_ > 0) {
+        size_t pending = std::exchange(buffer_used_, 0);
+        return WriteRaw(buffer_.get(), pending);
+    }
+    return true;
+}
+
+bool FileWriter::WriteRaw(const uint8_t* data, size_t size) {
+    if (size > 0 && std::fwrite(data, 1, size, file_) != size) {
+        good_ = false;
+        return false;
+    }
+    return true;
+}
+
+bool FileWriter::Commit() {
+    if (!file_) {
+        return false;
+    }
+
+    bool ok = Flush();
+    if (ok && sync_) {
+        ok = SyncFile(file_);
+    }
+    ok = (std::fclose(file_) == 0) && ok;
+    file_ = nullptr;
+
+    if (!temp_path_.empty()) {
+        std::error_code ec;
+        if (ok) {
+            std::filesystem::rename(temp_path_, path_, ec);
+            ok = !ec;
+        }
+        if (ok) {
+            SyncParentDirectory(path_);
+        } else {
+            std::filesystem::remove(temp_path_, ec);
+        }
+        temp_path_.clear();
+    }
+
+    good_ = ok;
+    return ok;
+}
+
+void FileWriter::Abort() noexcept {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    if (!temp_path_.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(temp_path_, ec);
+        temp_path_.clear();
+    }
+    buffer_used_ = 0;
+}
+
+void FileWriter::Reset() noexcept {
+    file_ = nullptr;
+    path_.clear();
+    temp_path_.clear();
+    sync_ = false;
+    good_ = true;
+    bytes_written_ = 0;
+    buffer_.reset();
+    buffer_capacity_ = 0;
+    buffer_used_ = 0;
+    buffer_charge_ = MemoryCharge();
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,229 @@
+#include "vision-infra/core/LatencyHistogram.hpp"
+#include "LogLinearBuckets.hpp"
+#include <algorithm>
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+constexpr uint8_t kSerializationVersion = 1;
+
+using Buckets = LogLinearBuckets<LatencyHistogram::kSubBucketBits, LatencyHistogram::kMaxExponent>;
+static_assert(Buckets::kCount == LatencyHistogram::kBucketCount);
+
+void UpdateMin(std::atomic<uint64_t>& target, uint64_t value) noexcept {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void UpdateMax(std::atomic<uint64_t>& target, uint64_t value) noexcept {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+// Unsigned LEB128
+void AppendVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool ReadVarint(std::span<const uint8_t>& data, uint64_t& value) {
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && !data.empty(); shift += 7) {
+        uint8_t byte = data.front();
+        data = data.subspan(1);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+double NsToMs(uint64_t nanoseconds) noexcept {
+    return static_cast<double>(nanoseconds) / 1e6;
+}
+
+} // namespace
+
+// LatencyHistogram implementation
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& other) noexcept {
+    *this = other;
+}
+
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other) noexcept {
+    if (this != &other) {
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            counts_[i].store(other.counts_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        total_ns_.store(other.total_ns_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        min_ns_.store(other.min_ns_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        max_ns_.store(other.max_ns_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+void LatencyHistogram::Record(std::chrono::nanoseconds latency) noexcept {
+    uint64_t nanoseconds = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+    counts_[Buckets::Index(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    total_ns_.fetch_add(nanoseconds, std::memory_order_relaxed);
+    UpdateMin(min_ns_, nanoseconds);
+    UpdateMax(max_ns_, nanoseconds);
+}
+
+void LatencyHistogram::RecordMs(double milliseconds) noexcept {
+    // Also maps NaN to zero
+    double nanoseconds = milliseconds > 0.0 ? std::min(milliseconds * 1e6, 9e18) : 0.0;
+    Record(std::chrono::nanoseconds(static_cast<int64_t>(nanoseconds)));
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) noexcept {
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        uint64_t count = other.counts_[i].load(std::memory_order_relaxed);
+        if (count != 0) {
+            counts_[i].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+    total_ns_.fetch_add(other.total_ns_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    UpdateMin(min_ns_, other.min_ns_.load(std::memory_order_relaxed));
+    UpdateMax(max_ns_, other.max_ns_.load(std::memory_order_relaxed));
+}
+
+void LatencyHistogram::Reset() noexcept {
+    for (auto& count : counts_) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    total_ns_.store(0, std::memory_order_relaxed);
+    min_ns_.store(UINT64_MAX, std::memory_order_relaxed);
+    max_ns_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetCount() const noexcept {
+    uint64_t count = 0;
+    for (const auto& bucket : counts_) {
+        count += bucket.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+double LatencyHistogram::GetMinMs() const noexcept {
+    uint64_t min = min_ns_.load(std::memory_order_relaxed);
+    return min == UINT64_MAX ? 0.0 : NsToMs(min);
+}
+
+double LatencyHistogram::GetMaxMs() const noexcept {
+    return NsToMs(max_ns_.load(std::memory_order_relaxed));
+}
+
+double LatencyHistogram::GetMeanMs() const noexcept {
+    uint64_t count = GetCount();
+    return count == 0 ? 0.0 : NsToMs(total_ns_.load(std::memory_order_relaxed)) / static_cast<double>(count);
+}
+
+double LatencyHistogram::GetPercentileMs(double percentile) const noexcept {
+    return NsToMs(PercentileNs(percentile, GetCount()));
+}
+
+LatencyStats LatencyHistogram::GetStats() const noexcept {
+    LatencyStats stats;
+    stats.count = GetCount();
+    if (stats.count == 0) {
+        return stats;
+    }
+    stats.min_ms = GetMinMs();
+    stats.max_ms = GetMaxMs();
+    stats.mean_ms = NsToMs(total_ns_.load(std::memory_order_relaxed)) / static_cast<double>(stats.count);
+    stats.p50_ms = NsToMs(PercentileNs(50.0, stats.count));
+    stats.p90_ms = NsToMs(PercentileNs(90.0, stats.count));
+    stats.p99_ms = NsToMs(PercentileNs(99.0, stats.count));
+    stats.p999_ms = NsToMs(PercentileNs(99.9, stats.count));
+    return stats;
+}
+
+std::vector<uint8_t> LatencyHistogram::Serialize() const {
+    std::vector<uint8_t> out;
+    out.reserve(64);
+    out.push_back(kSerializationVersion);
+    out.push_back(static_cast<uint8_t>(kSubBucketBits));
+    out.push_back(static_cast<uint8_t>(kMaxExponent));
+
+    uint64_t min = min_ns_.load(std::memory_order_relaxed);
+    AppendVarint(out, min == UINT64_MAX ? 0 : min);
+    AppendVarint(out, max_ns_.load(std::memory_order_relaxed));
+    AppendVarint(out, total_ns_.load(std::memory_order_relaxed));
+
+    // Non-empty buckets as (gap since the previous one, count)
+    size_t next = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        uint64_t count = counts_[i].load(std::memory_order_relaxed);
+        if (count != 0) {
+            AppendVarint(out, i - next);
+            AppendVarint(out, count);
+            next = i + 1;
+        }
+    }
+    return out;
+}
+
+std::optional<LatencyHistogram> LatencyHistogram::Deserialize(std::span<const uint8_t> data) {
+    if (data.size() < 3 || data[0] != kSerializationVersion || data[1] != kSubBucketBits || data[2] != kMaxExponent) {
+        return std::nullopt;
+    }
+    data = data.subspan(3);
+
+    uint64_t min = 0;
+    uint64_t max = 0;
+    uint64_t total = 0;
+    if (!ReadVarint(data, min) || !ReadVarint(data, max) || !ReadVarint(data, total)) {
+        return std::nullopt;
+    }
+
+    std::optional<LatencyHistogram> histogram(std::in_place);
+    uint64_t index = 0;
+    bool empty = true;
+    while (!data.empty()) {
+        uint64_t gap = 0;
+        uint64_t count = 0;
+        if (!ReadVarint(data, gap) || !ReadVarint(data, count) || gap >= kBucketCount - index) {
+            return std::nullopt;
+        }
+        index += gap;
+        histogram->counts_[index].store(count, std::memory_order_relaxed);
+        empty = empty && count == 0;
+        ++index;
+    }
+
+    if (!empty) {
+        histogram->min_ns_.store(min, std::memory_order_relaxed);
+        histogram->max_ns_.store(max, std::memory_order_relaxed);
+        histogram->total_ns_.store(total, std::memory_order_relaxed);
+    }
+    return histogram;
+}
+
+uint64_t LatencyHistogram::PercentileNs(double percentile, uint64_t count) const noexcept {
+    if (count == 0) {
+        return 0;
+    }
+    uint64_t min = min_ns_.load(std::memory_order_relaxed);
+    uint64_t max = max_ns_.load(std::memory_order_relaxed);
+    uint64_t rank = Buckets::Rank(percentile / 100.0, count);
+    if (rank == count) {
+        return max;
+    }
+
+    size_t bucket = Buckets::FindRank(rank, [this](size_t i) { return counts_[i].load(std::memory_order_relaxed); });
+    if (bucket == kBucketCount) {
+        return max;
+    }
+    return std::clamp(Buckets::Midpoint(bucket), std::min(min, max), max);
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Bucket layout shared by the log-linear histograms (LatencyHistogram and
+ * the profiler's zone durations). Values below 2^SubBucketBits get a bucket
+ * each; above, every power of two is split into 2^SubBucketBits buckets, so
+ * a bucket spans at most 1/2^SubBucketBits of its values. Values of
+ * 2^MaxExponent and more share the top bucket.
+ */
+template<unsigned SubBucketBits, unsigned MaxExponent>
+struct LogLinearBuckets {
+    static_assert(SubBucketBits > 0 && SubBucketBits < MaxExponent && MaxExponent <= 64);
+
+    static constexpr size_t kSubBuckets = size_t{1} << SubBucketBits;
+    static constexpr size_t kCount = kSubBuckets + (MaxExponent - SubBucketBits) * kSubBuckets;
+
+    static constexpr size_t Index(uint64_t value) noexcept {
+        if (value < kSubBuckets) {
+            return static_cast<size_t>(value);
+        }
+        auto exponent = static_cast<unsigned>(std::bit_width(value)) - 1;
+        if (exponent >= MaxExponent) {
+            return kCount - 1;
+        }
+        auto sub = static_cast<size_t>((value >> (exponent - SubBucketBits)) & (kSubBuckets - 1));
+        return kSubBuckets + (exponent - SubBucketBits) * kSubBuckets + sub;
+    }
+
+    static constexpr uint64_t Midpoint(size_t index) noexcept {
+        if (index < kSubBuckets) {
+            return index;
+        }
+        size_t exponent = (index - kSubBuckets) / kSubBuckets + SubBucketBits;
+        uint64_t sub = (index - kSubBuckets) % kSubBuckets;
+        uint64_t width = uint64_t{1} << (exponent - SubBucketBits);
+        return (kSubBuckets + sub) * width + width / 2;
+    }
+
+    /**
+     * 1-based rank of the q-quantile (q in [0, 1]) among count values
+     */
+    static uint64_t Rank(double q, uint64_t count) noexcept {
+        auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+        return std::clamp<uint64_t>(rank, 1, count);
+    }
+
+    /**
+     * Bucket holding the rank-th smallest value; count_at(i) is the number of
+     * values in bucket i. kCount if fewer than rank values were counted.
+     */
+    template<typename CountAt>
+    static size_t FindRank(uint64_t rank, CountAt&& count_at) noexcept {
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kCount; ++i) {
+            seen += count_at(i);
+            if (seen >= rank) {
+                return i;
+            }
+        }
+        return kCount;
+    }
+};
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "vision-infra/core/Logger.hpp"
+#include <chrono>
+#include <cstdint>
+#include <source_location>
+#include <string>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * A log message captured on the calling thread, before formatting
+ */
+struct LogRecord {
+    LogLevel level{LogLevel::INFO};
+    std::chrono::system_clock::time_point time;
+    uint64_t thread_id{0};
+    std::source_location location;
+    std::string message;
+};
+
+/**
+ * OS thread id of the calling thread, cached per thread
+ */
+uint64_t CurrentThreadId() noexcept;
+
+} // namespace core
+} // namespace vision_infra
@@ -1,61 +1,329 @@
 #include "vision-infra/core/Logger.hpp"
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include "vision-infra/core/Profiler.hpp"
+#include "vision-infra/core/RotatingFileSink.hpp"
+#include "BoundedQueue.hpp"
+#include "LogRecord.hpp"
+#include "PatternFormatter.hpp"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
-#include <fstream>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <utility>
 #include <unordered_map>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace vision_infra {
 namespace core {
 
+namespace {
+
+// Maximum records written between two stream flushes on the writer thread
+constexpr size_t kAsyncWriteBatch = 256;
+
+// Writes file lines whose flush_interval has elapsed; returns when the next
+// buffered lines fall due, nullopt if none are buffered
+using FlushIfDueFn = std::function<std::optional<std::chrono::steady_clock::time_point>()>;
+
+/**
+ * Timer thread of a synchronous logger with a file sink: writes buffered
+ * lines to disk once flush_interval has elapsed even if no further line
+ * arrives. Notify() is called when the sink's buffer stops being empty.
+ */
+class FlushTimer {
+public:
+    explicit FlushTimer(FlushIfDueFn flush_if_due)
+        : flush_if_due_(std::move(flush_if_due)), thread_([this] { Run(); }) {}
+
+    ~FlushTimer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+
+    FlushTimer(const FlushTimer&) = delete;
+    FlushTimer& operator=(const FlushTimer&) = delete;
+
+    void Notify() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            notified_ = true;
+        }
+        cv_.notify_one();
+    }
+
+private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_) {
+            notified_ = false;
+            lock.unlock();
+            auto deadline = flush_if_due_();
+            lock.lock();
+
+            auto woken = [this] { return stopping_ || notified_; };
+            if (deadline) {
+                cv_.wait_until(lock, *deadline, woken);
+            } else {
+                cv_.wait(lock, woken);
+            }
+        }
+    }
+
+    FlushIfDueFn flush_if_due_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_{false};
+    bool notified_{false};
+    std::thread thread_;
+};
+
+/**
+ * Background writer for asynchronous logging. Producers never take a lock:
+ * they push into a lock-free queue and only wake the writer when it sleeps.
+ */
+class AsyncLogWorker {
+public:
+    using WriteBatchFn = std::function<void(std::vector<LogRecord>&)>;
+
+    AsyncLogWorker(const AsyncOptions& options, WriteBatchFn write_batch, FlushIfDueFn flush_if_due)
+        : queue_(options.queue_capacity),
+          policy_(options.overflow_policy),
+          write_batch_(std::move(write_batch)),
+          flush_if_due_(std::move(flush_if_due)),
+          thread_([this] { Run(); }) {
+        queue_charge_.Allocate(queue_.Capacity() * sizeof(LogRecord));
+    }
+
+    ~AsyncLogWorker() {
+        stopping_.store(true, std::memory_order_seq_cst);
+        Wake();
+        thread_.join();
+    }
+
+    AsyncLogWorker(const AsyncLogWorker&) = delete;
+    AsyncLogWorker& operator=(const AsyncLogWorker&) = delete;
+
+    void Push(LogRecord& record) {
+        submitted_.fetch_add(1, std::memory_order_seq_cst);
+        while (!queue_.TryPush(record)) {
+            switch (policy_) {
+                case OverflowPolicy::DROP_NEWEST:
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    completed_.fetch_add(1, std::memory_order_seq_cst);
+                    return;
+                case OverflowPolicy::DROP_OLDEST: {
+                    LogRecord oldest;
+                    if (queue_.TryPop(oldest)) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        completed_.fetch_add(1, std::memory_order_seq_cst);
+                    }
+                    break;
+                }
+                case OverflowPolicy::BLOCK:
+                    Wake();
+                    std::this_thread::yield();
+                    break;
+            }
+        }
+        if (sleeping_.load(std::memory_order_seq_cst)) {
+            Wake();
+        }
+    }
+
+    // Block until every record pushed before the call has been handed to the
+    // writer (or dropped). Waits for a ticket rather than for an empty queue,
+    // so producers that keep logging cannot hold it up.
+    void Drain() const {
+        uint64_t ticket = submitted_.load(std::memory_order_seq_cst);
+        while (completed_.load(std::memory_order_acquire) < ticket) {
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t GetDroppedCount() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    uint64_t Pending() const {
+        // completed_ first, so the difference cannot underflow
+        uint64_t completed = completed_.load(std::memory_order_seq_cst);
+        return submitted_.load(std::memory_order_seq_cst) - completed;
+    }
+
+    // Only called while the writer sleeps, or when a BLOCK producer waits for room
+    void Wake() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            ++wake_;
+        }
+        wake_cv_.notify_one();
+    }
+
+    void Run() {
+        std::vector<LogRecord> batch;
+        batch.reserve(kAsyncWriteBatch);
+        for (;;) {
+            LogRecord record;
+            while (batch.size() < kAsyncWriteBatch && queue_.TryPop(record)) {
+                batch.push_back(std::move(record));
+            }
+            if (!batch.empty()) {
+                size_t written = batch.size();
+                write_batch_(batch);
+                batch.clear();
+                completed_.fetch_add(written, std::memory_order_seq_cst);
+                continue;
+            }
+
+            if (stopping_.load(std::memory_order_seq_cst) && Pending() == 0) {
+                return;
+            }
+
+            // Idle: write lines whose flush_interval elapsed, and sleep no
+            // longer than until the next ones fall due
+            auto flush_deadline = flush_if_due_();
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            uint64_t seen = wake_;
+            sleeping_.store(true, std::memory_order_seq_cst);
+            if (Pending() == 0 && !stopping_.load(std::memory_order_seq_cst)) {
+                auto woken = [this, seen] { return wake_ != seen; };
+                if (flush_deadline) {
+                    wake_cv_.wait_until(lock, *flush_deadline, woken);
+                } else {
+                    wake_cv_.wait(lock, woken);
+                }
+            }
+            sleeping_.store(false, std::memory_order_seq_cst);
+        }
+    }
+
+    BoundedQueue<LogRecord> queue_;
+    MemoryCharge queue_charge_{MemoryTag::LOGGING};  // Slots only; message text is not counted
+    OverflowPolicy policy_;
+    WriteBatchFn write_batch_;
+    FlushIfDueFn flush_if_due_;
+    // Records pushed, and records written or dropped; completed_ never passes submitted_
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> completed_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    uint64_t wake_{0};  // Guarded by wake_mutex_
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> stopping_{false};
+    std::thread thread_;
+};
+
+} // namespace
+
 // Logger::Impl (PIMPL implementation)
 class Logger::Impl {
 public:
     std::string name_;
-    LogLevel current_level_{LogLevel::INFO};
-    std::ofstream file_stream_;
+    std::atomic<LogLevel> current_level_{LogLevel::INFO};
+    std::unique_ptr<RotatingFileSink> file_sink_;
     bool console_enabled_{true};
-    bool timestamp_enabled_{true};
-    std::string pattern_{"[{timestamp}] [{level}] [{name}] {message}"};
+    PatternFormatter formatter_;
     std::mutex log_mutex_;
+    std::unique_ptr<AsyncLogWorker> async_worker_;
+    std::unique_ptr<FlushTimer> flush_timer_;  // Synchronous mode with a file sink only
+    std::shared_ptr<BinaryLogSink> binary_sink_;
+    uint32_t binary_logger_id_{0};
+    uint64_t retired_dropped_{0};
+    
+    ~Impl() {
+        // Stop the writer and timer before the streams they write to are destroyed
+        async_worker_.reset();
+        flush_timer_.reset();
+    }
     
-    std::string FormatMessage(LogLevel level, const std::string& message) {
-        std::string formatted = pattern_;
+    // Caller holds log_mutex_
+    void WriteRecord(const LogRecord& record, std::string_view message) {
+        PROFILE_ZONE("log.write");
+        thread_local std::string buffer;
+        buffer.clear();
+        formatter_.Format(record, message, name_, buffer);
+        buffer.push_back('\n');
         
-        // Replace timestamp
-        if (timestamp_enabled_) {
-            auto now = std::chrono::system_clock::now();
-            auto time_t = std::chrono::system_clock::to_time_t(now);
-            std::stringstream ss;
-            ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-            
-            size_t pos = formatted.find("{timestamp}");
-            if (pos != std::string::npos) {
-                formatted.replace(pos, 11, ss.str());
-            }
+        // Console output
+        if (console_enabled_) {
+            auto& stream = record.level >= LogLevel::ERROR ? std::cerr : std::cout;
+            stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
         }
         
-        // Replace level
-        size_t pos = formatted.find("{level}");
-        if (pos != std::string::npos) {
-            formatted.replace(pos, 7, LoggerManager::LogLevelToString(level));
+        // File output; the sink decides when buffered lines reach the disk
+        if (file_sink_) {
+            bool was_buffering = file_sink_->GetFlushDeadline().has_value();
+            file_sink_->Write(buffer, record.level);
+            if (flush_timer_ && !was_buffering && file_sink_->GetFlushDeadline()) {
+                flush_timer_->Notify();
+            }
         }
-        
-        // Replace name
-        pos = formatted.find("{name}");
-        if (pos != std::string::npos) {
-            formatted.replace(pos, 6, name_);
+    }
+    
+    // Caller holds log_mutex_
+    void FlushConsole() {
+        if (console_enabled_) {
+            std::cout.flush();
+            std::cerr.flush();
         }
-        
-        // Replace message
-        pos = formatted.find("{message}");
-        if (pos != std::string::npos) {
-            formatted.replace(pos, 9, message);
+    }
+    
+    // Caller holds log_mutex_
+    void FlushStreams() {
+        FlushConsole();
+        if (file_sink_) {
+            file_sink_->Flush();
+        }
+    }
+    
+    std::optional<std::chrono::steady_clock::time_point> FlushFileIfDue() {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (!file_sink_) {
+            return std::nullopt;
+        }
+        file_sink_->FlushIfDue();
+        return file_sink_->GetFlushDeadline();
+    }
+    
+    void StopAsyncWorker() {
+        if (async_worker_) {
+            retired_dropped_ += async_worker_->GetDroppedCount();
+            async_worker_.reset();
         }
-        
-        return formatted;
+    }
+    
+    // Starts or stops the timer thread; called after the sink or mode changed
+    void UpdateFlushTimer() {
+        std::unique_ptr<FlushTimer> stopped;  // Joined after log_mutex_ is released
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        bool needed = file_sink_ && !async_worker_;
+        if (needed && !flush_timer_) {
+            flush_timer_ = std::make_unique<FlushTimer>([this] { return FlushFileIfDue(); });
+        } else if (!needed) {
+            stopped = std::move(flush_timer_);
+        }
+    }
+    
+    // Runs on the async writer thread; one lock and one console flush per batch
+    void WriteBatch(std::vector<LogRecord>& batch) {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        for (const auto& record : batch) {
+            WriteRecord(record, record.message);
+        }
+        FlushConsole();
     }
 };
 
@@ -64,68 +332,120 @@ Logger::Logger(const std::string& name) : pImpl_(std::make_unique<Impl>()) {
     pImpl_->name_ = name.empty() ? "default" : name;
 }
 
+Logger::~Logger() = default;
+
 void Logger::Log(LogLevel level, const std::string& message) {
-    if (level < pImpl_->current_level_) return;
+    LogAt(level, message, std::source_location());
+}
+
+void Logger::LogAt(LogLevel level, const std::string& message, const std::source_location& location) {
+    if (level < pImpl_->current_level_.load(std::memory_order_relaxed)) return;
     
-    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
+    if (pImpl_->binary_sink_) {
+        pImpl_->binary_sink_->WriteMessage(level, pImpl_->binary_logger_id_, message);
+        return;
+    }
     
-    std::string formatted = pImpl_->FormatMessage(level, message);
+    LogRecord record{level, std::chrono::system_clock::now(), CurrentThreadId(), location, {}};
     
-    // Console output
-    if (pImpl_->console_enabled_) {
-        if (level >= LogLevel::ERROR) {
-            std::cerr << formatted << std::endl;
-        } else {
-            std::cout << formatted << std::endl;
-        }
+    if (pImpl_->async_worker_) {
+        record.message = message;
+        pImpl_->async_worker_->Push(record);
+        return;
     }
     
-    // File output
-    if (pImpl_->file_stream_.is_open()) {
-        pImpl_->file_stream_ << formatted << std::endl;
-    }
+    // Synchronous records are written before returning, so the message is not copied
+    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
+    pImpl_->WriteRecord(record, message);
+    pImpl_->FlushConsole();
 }
 
 void Logger::SetLevel(LogLevel level) {
-    pImpl_->current_level_ = level;
+    pImpl_->current_level_.store(level, std::memory_order_relaxed);
 }
 
 LogLevel Logger::GetLevel() const {
-    return pImpl_->current_level_;
+    return pImpl_->current_level_.load(std::memory_order_relaxed);
 }
 
 void Logger::Flush() {
-    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
-    if (pImpl_->console_enabled_) {
-        std::cout.flush();
-        std::cerr.flush();
+    if (pImpl_->binary_sink_) {
+        pImpl_->binary_sink_->Flush();
     }
-    if (pImpl_->file_stream_.is_open()) {
-        pImpl_->file_stream_.flush();
+    if (pImpl_->async_worker_) {
+        pImpl_->async_worker_->Drain();
     }
+    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
+    pImpl_->FlushStreams();
 }
 
-void Logger::SetOutputFile(const std::string& filename) {
-    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
-    if (pImpl_->file_stream_.is_open()) {
-        pImpl_->file_stream_.close();
+void Logger::SetOutputFile(const std::string& filename, const FileSinkOptions& options) {
+    std::unique_ptr<RotatingFileSink> sink;
+    if (!filename.empty()) {
+        sink = std::make_unique<RotatingFileSink>(filename, options);
     }
     
-    if (!filename.empty()) {
-        pImpl_->file_stream_.open(filename, std::ios::app);
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
+        pImpl_->file_sink_ = std::move(sink);
     }
+    pImpl_->UpdateFlushTimer();
 }
 
 void Logger::EnableConsoleOutput(bool enable) {
+    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
     pImpl_->console_enabled_ = enable;
 }
 
 void Logger::EnableTimestamp(bool enable) {
-    pImpl_->timestamp_enabled_ = enable;
+    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
+    pImpl_->formatter_.EnableTimestamp(enable);
 }
 
 void Logger::SetPattern(const std::string& pattern) {
-    pImpl_->pattern_ = pattern;
+    std::lock_guard<std::mutex> lock(pImpl_->log_mutex_);
+    pImpl_->formatter_.SetPattern(pattern);
+}
+
+void Logger::EnableAsync(const AsyncOptions& options) {
+    pImpl_->StopAsyncWorker();
+    auto* impl = pImpl_.get();
+    pImpl_->async_worker_ = std::make_unique<AsyncLogWorker>(
+        options, [impl](std::vector<LogRecord>& batch) { impl->WriteBatch(batch); },
+        [impl] { return impl->FlushFileIfDue(); });
+    pImpl_->UpdateFlushTimer();
+}
+
+void Logger::DisableAsync() {
+    pImpl_->StopAsyncWorker();
+    pImpl_->UpdateFlushTimer();
+}
+
+bool Logger::IsAsync() const {
+    return pImpl_->async_worker_ != nullptr;
+}
+
+uint64_t Logger::GetDroppedCount() const {
+    uint64_t dropped = pImpl_->retired_dropped_;
+    if (pImpl_->async_worker_) {
+        dropped += pImpl_->async_worker_->GetDroppedCount();
+    }
+    return dropped;
+}
+
+void Logger::SetBinaryOutput(std::shared_ptr<BinaryLogSink> sink) {
+    if (sink) {
+        pImpl_->binary_logger_id_ = sink->RegisterLogger(pImpl_->name_);
+    }
+    pImpl_->binary_sink_ = std::move(sink);
+}
+
+BinaryLogSink* Logger::GetBinarySink() const noexcept {
+    return pImpl_->binary_sink_.get();
+}
+
+uint32_t Logger::GetBinaryLoggerId() const noexcept {
+    return pImpl_->binary_logger_id_;
 }
 
 void Logger::Trace(const std::string& message) {
@@ -153,15 +473,92 @@ void Logger::Fatal(const std::string& message) {
 }
 
 // LoggerManager implementation
+namespace {
+
+constexpr std::string_view kDefaultLoggerName = "default";
+
+struct LoggerNameHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>{}(name); }
+};
+
+using LoggerMap = std::unordered_map<std::string, std::shared_ptr<ILogger>, LoggerNameHash, std::equal_to<>>;
+
+} // namespace
+
 class LoggerManagerImpl {
 public:
-    std::unordered_map<std::string, std::shared_ptr<ILogger>> loggers_;
-    std::shared_ptr<ILogger> default_logger_;
+    // Read-mostly registry: lookups load the published map without taking
+    // manager_mutex_, writers copy it under the mutex and publish the copy.
+    // A replaced map is freed once the last reader drops it; loggers stay
+    // alive through the maps that still hold them.
+    std::atomic<std::shared_ptr<const LoggerMap>> registry_;
+    // Default loggers replaced by SetDefaultLogger, kept so that references
+    // and handles to them stay valid. Grows by one logger per replacement
+    // and is only released at exit.
+    std::vector<std::shared_ptr<ILogger>> retired_defaults_;
+    std::atomic<ILogger*> default_logger_raw_{nullptr};
     std::mutex manager_mutex_;
     LogLevel global_level_{LogLevel::INFO};
+    std::optional<AsyncOptions> async_options_;
     
     LoggerManagerImpl() {
-        default_logger_ = std::make_shared<Logger>("default");
+        LoggerMap registry;
+        auto default_logger = std::make_shared<Logger>(std::string(kDefaultLoggerName));
+        default_logger_raw_.store(default_logger.get(), std::memory_order_release);
+        registry.emplace(kDefaultLoggerName, std::move(default_logger));
+        Publish(std::move(registry));
+    }
+    
+    std::shared_ptr<const LoggerMap> Registry() const noexcept {
+        return registry_.load(std::memory_order_acquire);
+    }
+    
+    // Caller holds manager_mutex_ (or is the constructor)
+    void Publish(LoggerMap registry) {
+        registry_.store(std::make_shared<const LoggerMap>(std::move(registry)), std::memory_order_release);
+    }
+    
+    std::shared_ptr<ILogger> FindOrCreate(std::string_view name) {
+        if (name.empty()) {
+            name = kDefaultLoggerName;
+        }
+        
+        // Fast path: existing loggers are found without taking the mutex
+        auto registry = Registry();
+        auto it = registry->find(name);
+        if (it != registry->end()) {
+            return it->second;
+        }
+        
+        std::lock_guard<std::mutex> lock(manager_mutex_);
+        registry = Registry();
+        it = registry->find(name);
+        if (it != registry->end()) {
+            return it->second;
+        }
+        
+        auto logger = std::make_shared<Logger>(std::string(name));
+        logger->SetLevel(global_level_);
+        if (async_options_) {
+            logger->EnableAsync(*async_options_);
+        }
+        LoggerMap updated = *registry;
+        updated.emplace(name, logger);
+        Publish(std::move(updated));
+        return logger;
+    }
+    
+    // Caller holds manager_mutex_
+    void RetireDefault(std::shared_ptr<ILogger> logger) {
+        logger->Flush();
+        if (auto* retired = dynamic_cast<Logger*>(logger.get())) {
+            // Threads holding a stale reference may still be inside LogAt, which
+            // reads the async worker and binary sink without a lock, so only the
+            // file sink (guarded by log_mutex_) is closed
+            retired->SetOutputFile("");
+        }
+        retired_defaults_.push_back(std::move(logger));
     }
 };
 
@@ -171,28 +568,32 @@ static LoggerManagerImpl& GetManagerImpl() {
 }
 
 std::shared_ptr<ILogger> LoggerManager::GetLogger(const std::string& name) {
-    auto& impl = GetManagerImpl();
-    std::lock_guard<std::mutex> lock(impl.manager_mutex_);
-    
-    if (name.empty() || name == "default") {
-        return impl.default_logger_;
-    }
-    
-    auto it = impl.loggers_.find(name);
-    if (it != impl.loggers_.end()) {
-        return it->second;
-    }
-    
-    auto logger = std::make_shared<Logger>(name);
-    logger->SetLevel(impl.global_level_);
-    impl.loggers_[name] = logger;
-    return logger;
+    return GetManagerImpl().FindOrCreate(name);
+}
+
+LoggerHandle LoggerManager::GetHandle(std::string_view name) {
+    return LoggerHandle(*GetManagerImpl().FindOrCreate(name));
+}
+
+ILogger& LoggerManager::GetDefaultLoggerRef() noexcept {
+    return *GetManagerImpl().default_logger_raw_.load(std::memory_order_acquire);
 }
 
 void LoggerManager::SetDefaultLogger(std::shared_ptr<ILogger> logger) {
+    if (!logger) {
+        logger = std::make_shared<Logger>(std::string(kDefaultLoggerName));
+    }
+    
     auto& impl = GetManagerImpl();
     std::lock_guard<std::mutex> lock(impl.manager_mutex_);
-    impl.default_logger_ = logger;
+    LoggerMap updated = *impl.Registry();
+    auto& slot = updated[std::string(kDefaultLoggerName)];
+    auto previous = std::exchange(slot, logger);
+    impl.default_logger_raw_.store(logger.get(), std::memory_order_release);
+    impl.Publish(std::move(updated));
+    if (previous && previous != logger) {
+        impl.RetireDefault(std::move(previous));
+    }
 }
 
 void LoggerManager::SetGlobalLevel(LogLevel level) {
@@ -201,14 +602,35 @@ void LoggerManager::SetGlobalLevel(LogLevel level) {
     impl.global_level_ = level;
     
     // Update all existing loggers
-    if (impl.default_logger_) {
-        impl.default_logger_->SetLevel(level);
-    }
-    for (auto& [name, logger] : impl.loggers_) {
+    for (const auto& [name, logger] : *impl.Registry()) {
         logger->SetLevel(level);
     }
 }
 
+void LoggerManager::EnableAsync(const AsyncOptions& options) {
+    auto& impl = GetManagerImpl();
+    std::lock_guard<std::mutex> lock(impl.manager_mutex_);
+    impl.async_options_ = options;
+    
+    for (const auto& [name, registered] : *impl.Registry()) {
+        if (auto* logger = dynamic_cast<Logger*>(registered.get())) {
+            logger->EnableAsync(options);
+        }
+    }
+}
+
+void LoggerManager::DisableAsync() {
+    auto& impl = GetManagerImpl();
+    std::lock_guard<std::mutex> lock(impl.manager_mutex_);
+    impl.async_options_.reset();
+    
+    for (const auto& [name, registered] : *impl.Registry()) {
+        if (auto* logger = dynamic_cast<Logger*>(registered.get())) {
+            logger->DisableAsync();
+        }
+    }
+}
+
 LogLevel LoggerManager::ParseLogLevel(const std::string& level) {
     std::string lower_level = level;
     std::transform(lower_level.begin(), lower_level.end(), lower_level.begin(), ::tolower);
@@ -224,15 +646,7 @@ LogLevel LoggerManager::ParseLogLevel(const std::string& level) {
 }
 
 std::string LoggerManager::LogLevelToString(LogLevel level) {
-    switch (level) {
-        case LogLevel::TRACE: return "TRACE";
-        case LogLevel::DEBUG: return "DEBUG";
-        case LogLevel::INFO: return "INFO";
-        case LogLevel::WARN: return "WARN";
-        case LogLevel::ERROR: return "ERROR";
-        case LogLevel::FATAL: return "FATAL";
-        default: return "UNKNOWN";
-    }
+    return std::string(LogLevelName(level));
 }
 
 } // namespace core
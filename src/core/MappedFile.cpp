@@ -0,0 +1,102 @@
+#include "vision-infra/core/MappedFile.hpp"
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vision_infra {
+namespace core {
+
+MappedFile::~MappedFile() {
+    Release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      fallback_(std::move(other.fallback_)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        fallback_ = std::move(other.fallback_);
+    }
+    return *this;
+}
+
+void MappedFile::Release() noexcept {
+#ifndef _WIN32
+    if (data_ && !fallback_) {
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    fallback_.reset();
+    data_ = nullptr;
+    size_ = 0;
+}
+
+std::optional<MappedFile> MappedFile::Open(const std::string& path, AccessHint hint) {
+    MappedFile mapped;
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    if (info.st_size == 0) {
+        ::close(fd);
+        return mapped;
+    }
+
+    auto size = static_cast<size_t>(info.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return std::nullopt;
+    }
+
+    int advice = MADV_NORMAL;
+    switch (hint) {
+        case AccessHint::NORMAL: advice = MADV_NORMAL; break;
+        case AccessHint::SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+        case AccessHint::RANDOM: advice = MADV_RANDOM; break;
+        case AccessHint::WILL_NEED: advice = MADV_WILLNEED; break;
+    }
+    ::madvise(data, size, advice);
+
+    mapped.data_ = static_cast<const uint8_t*>(data);
+    mapped.size_ = size;
+#else
+    (void)hint;
+    std::ifstream file(path, std::ios::binary);
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (!file.is_open() || ec) {
+        return std::nullopt;
+    }
+    mapped.fallback_ = std::make_unique<uint8_t[]>(size);
+    if (!file.read(reinterpret_cast<char*>(mapped.fallback_.get()), static_cast<std::streamsize>(size))) {
+        return std::nullopt;
+    }
+    mapped.data_ = mapped.fallback_.get();
+    mapped.size_ = size;
+#endif
+    return mapped;
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,141 @@
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+// One cache line per tag so that subsystems on different threads do not contend
+struct alignas(64) TagCounters {
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> peak_bytes{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+};
+
+std::atomic<bool> g_enabled{false};
+std::array<TagCounters, kMemoryTagCount> g_counters;
+
+TagCounters& CountersFor(MemoryTag tag) noexcept {
+    return g_counters[static_cast<size_t>(tag)];
+}
+
+} // namespace
+
+// MemoryAccounting implementation
+void MemoryAccounting::SetEnabled(bool enabled) noexcept {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool MemoryAccounting::IsEnabled() noexcept {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+MemoryTagStats MemoryAccounting::GetStats(MemoryTag tag) noexcept {
+    const auto& counters = CountersFor(tag);
+    MemoryTagStats stats;
+    stats.live_bytes = counters.live_bytes.load(std::memory_order_relaxed);
+    stats.peak_bytes = std::max(counters.peak_bytes.load(std::memory_order_relaxed), stats.live_bytes);
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.frees = counters.frees.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::array<MemoryTagStats, kMemoryTagCount> MemoryAccounting::GetAllStats() noexcept {
+    std::array<MemoryTagStats, kMemoryTagCount> stats;
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        stats[i] = GetStats(static_cast<MemoryTag>(i));
+    }
+    return stats;
+}
+
+void MemoryAccounting::ResetPeaks() noexcept {
+    for (auto& counters : g_counters) {
+        counters.peak_bytes.store(counters.live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+std::string_view MemoryAccounting::GetTagName(MemoryTag tag) noexcept {
+    switch (tag) {
+        case MemoryTag::PREPROCESSING: return "preprocessing";
+        case MemoryTag::DATASET: return "dataset";
+        case MemoryTag::CACHE: return "cache";
+        case MemoryTag::LOGGING: return "logging";
+        case MemoryTag::IO: return "io";
+        case MemoryTag::OTHER: return "other";
+    }
+    return "unknown";
+}
+
+void MemoryAccounting::Allocate(MemoryTag tag, size_t bytes) noexcept {
+    auto& counters = CountersFor(tag);
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    size_t live = counters.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t peak = counters.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void MemoryAccounting::Free(MemoryTag tag, size_t bytes, uint64_t count) noexcept {
+    auto& counters = CountersFor(tag);
+    counters.frees.fetch_add(count, std::memory_order_relaxed);
+    counters.live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+// MemoryCharge implementation
+MemoryCharge::MemoryCharge(MemoryTag tag) noexcept : tag_(tag), active_(MemoryAccounting::IsEnabled()) {}
+
+MemoryCharge::~MemoryCharge() {
+    Reset();
+}
+
+MemoryCharge::MemoryCharge(MemoryCharge&& other) noexcept
+    : tag_(other.tag_),
+      active_(std::exchange(other.active_, false)),
+      bytes_(std::exchange(other.bytes_, 0)),
+      allocations_(std::exchange(other.allocations_, 0)) {}
+
+MemoryCharge& MemoryCharge::operator=(MemoryCharge&& other) noexcept {
+    if (this != &other) {
+        Reset();
+        tag_ = other.tag_;
+        active_ = std::exchange(other.active_, false);
+        bytes_ = std::exchange(other.bytes_, 0);
+        allocations_ = std::exchange(other.allocations_, 0);
+    }
+    return *this;
+}
+
+void MemoryCharge::Allocate(size_t bytes) noexcept {
+    if (active_ && bytes > 0) {
+        bytes_ += bytes;
+        ++allocations_;
+        MemoryAccounting::Allocate(tag_, bytes);
+    }
+}
+
+void MemoryCharge::Free(size_t bytes, uint64_t count) noexcept {
+    bytes = std::min(bytes, bytes_);
+    if (active_ && bytes > 0 && count > 0) {
+        bytes_ -= bytes;
+        allocations_ -= std::min(count, allocations_);
+        MemoryAccounting::Free(tag_, bytes, count);
+    }
+}
+
+void MemoryCharge::Reset() noexcept {
+    // Every allocation still charged counts as freed, so allocations and
+    // frees balance once all charges are gone
+    if (active_ && bytes_ > 0) {
+        MemoryAccounting::Free(tag_, bytes_, std::max<uint64_t>(allocations_, 1));
+    }
+    bytes_ = 0;
+    allocations_ = 0;
+    active_ = false;
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,178 @@
+#include "PatternFormatter.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <ctime>
+#include <functional>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+template<typename Integer>
+void AppendInteger(std::string& out, Integer value, int min_width = 0) {
+    std::array<char, 24> digits{};
+    auto [end, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    (void)ec;
+    auto length = static_cast<int>(end - digits.data());
+    for (int i = length; i < min_width; ++i) {
+        out.push_back('0');
+    }
+    out.append(digits.data(), end);
+}
+
+// "YYYY-MM-DD HH:MM:SS" for the current second, so localtime runs at most
+// once per second on each thread
+std::string_view CachedSecondText(std::time_t seconds) {
+    thread_local std::time_t cached_second = -1;
+    thread_local std::array<char, 32> cached_text{};
+    thread_local size_t cached_length = 0;
+
+    if (seconds != cached_second) {
+        std::tm local{};
+#ifdef _WIN32
+        localtime_s(&local, &seconds);
+#else
+        localtime_r(&seconds, &local);
+#endif
+        cached_length = std::strftime(cached_text.data(), cached_text.size(), "%Y-%m-%d %H:%M:%S", &local);
+        cached_second = seconds;
+    }
+    return {cached_text.data(), cached_length};
+}
+
+} // namespace
+
+uint64_t CurrentThreadId() noexcept {
+#ifdef __linux__
+    thread_local const uint64_t id = static_cast<uint64_t>(::syscall(SYS_gettid));
+#else
+    thread_local const uint64_t id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+    return id;
+}
+
+std::string_view LogLevelName(LogLevel level) noexcept {
+    switch (level) {
+        case LogLevel::TRACE: return "TRACE";
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO: return "INFO";
+        case LogLevel::WARN: return "WARN";
+        case LogLevel::ERROR: return "ERROR";
+        case LogLevel::FATAL: return "FATAL";
+        default: return "UNKNOWN";
+    }
+}
+
+PatternFormatter::PatternFormatter(std::string_view pattern) {
+    SetPattern(pattern);
+}
+
+void PatternFormatter::SetPattern(std::string_view pattern) {
+    static constexpr std::array<std::pair<std::string_view, Field>, 11> kFields = {{
+        {"timestamp", Field::TIMESTAMP},
+        {"ms", Field::MILLIS},
+        {"us", Field::MICROS},
+        {"level", Field::LEVEL},
+        {"name", Field::NAME},
+        {"message", Field::MESSAGE},
+        {"thread", Field::THREAD},
+        {"source", Field::SOURCE},
+        {"file", Field::FILE},
+        {"line", Field::LINE},
+        {"function", Field::FUNCTION},
+    }};
+
+    tokens_.clear();
+    std::string literal;
+    size_t pos = 0;
+    while (pos < pattern.size()) {
+        size_t open = pattern.find('{', pos);
+        size_t close = open == std::string_view::npos ? open : pattern.find('}', open);
+        if (close == std::string_view::npos) {
+            literal.append(pattern.substr(pos));
+            break;
+        }
+
+        literal.append(pattern.substr(pos, open - pos));
+        std::string_view name = pattern.substr(open + 1, close - open - 1);
+        auto field = std::find_if(kFields.begin(), kFields.end(),
+                                  [name](const auto& entry) { return entry.first == name; });
+        if (field == kFields.end()) {
+            literal.append(pattern.substr(open, close - open + 1));
+        } else {
+            if (!literal.empty()) {
+                tokens_.push_back({Field::LITERAL, std::move(literal)});
+                literal.clear();
+            }
+            tokens_.push_back({field->second, {}});
+        }
+        pos = close + 1;
+    }
+    if (!literal.empty()) {
+        tokens_.push_back({Field::LITERAL, std::move(literal)});
+    }
+}
+
+void PatternFormatter::Format(const LogRecord& record, std::string_view message, std::string_view logger_name,
+                              std::string& out) const {
+    using namespace std::chrono;
+    const auto since_epoch = record.time.time_since_epoch();
+    const auto seconds = duration_cast<std::chrono::seconds>(since_epoch);
+    const auto micros = duration_cast<microseconds>(since_epoch - seconds).count();
+
+    for (const auto& token : tokens_) {
+        switch (token.field) {
+            case Field::LITERAL:
+                out.append(token.literal);
+                break;
+            case Field::TIMESTAMP:
+                if (timestamp_enabled_) {
+                    out.append(CachedSecondText(static_cast<std::time_t>(seconds.count())));
+                }
+                break;
+            case Field::MILLIS:
+                AppendInteger(out, micros / 1000, 3);
+                break;
+            case Field::MICROS:
+                AppendInteger(out, micros, 6);
+                break;
+            case Field::LEVEL:
+                out.append(LogLevelName(record.level));
+                break;
+            case Field::NAME:
+                out.append(logger_name);
+                break;
+            case Field::MESSAGE:
+                out.append(message);
+                break;
+            case Field::THREAD:
+                AppendInteger(out, record.thread_id);
+                break;
+            case Field::SOURCE:
+                out.append(record.location.file_name());
+                out.push_back(':');
+                AppendInteger(out, record.location.line());
+                break;
+            case Field::FILE:
+                out.append(record.location.file_name());
+                break;
+            case Field::LINE:
+                AppendInteger(out, record.location.line());
+                break;
+            case Field::FUNCTION:
+                out.append(record.location.function_name());
+                break;
+        }
+    }
+}
+
+} // namespace core
+} // namespace vision_infra
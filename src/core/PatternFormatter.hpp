@@ -0,0 +1,61 @@
+#pragma once
+
+#include "LogRecord.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+/**
+ * Log pattern compiled once into literal and field tokens.
+ *
+ * Supported fields: {timestamp} {ms} {us} {level} {name} {message} {thread}
+ * {source} {file} {line} {function}. Unknown fields are kept as literal text.
+ */
+class PatternFormatter {
+public:
+    static constexpr std::string_view kDefaultPattern = "[{timestamp}] [{level}] [{name}] {message}";
+
+    explicit PatternFormatter(std::string_view pattern = kDefaultPattern);
+
+    void SetPattern(std::string_view pattern);
+    void EnableTimestamp(bool enable) noexcept { timestamp_enabled_ = enable; }
+
+    /**
+     * Append the formatted record to out; message is passed separately so the
+     * synchronous path can format without copying it into the record
+     */
+    void Format(const LogRecord& record, std::string_view message, std::string_view logger_name,
+                std::string& out) const;
+
+private:
+    enum class Field {
+        LITERAL,
+        TIMESTAMP,
+        MILLIS,
+        MICROS,
+        LEVEL,
+        NAME,
+        MESSAGE,
+        THREAD,
+        SOURCE,
+        FILE,
+        LINE,
+        FUNCTION
+    };
+
+    struct Token {
+        Field field;
+        std::string literal;
+    };
+
+    std::vector<Token> tokens_;
+    bool timestamp_enabled_{true};
+};
+
+std::string_view LogLevelName(LogLevel level) noexcept;
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,739 @@
+#include "vision-infra/core/Profiler.hpp"
+#include "vision-infra/core/FileWriter.hpp"
+#include "LogLinearBuckets.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define VISION_INFRA_PROFILER_HAS_TSC 1
+#endif
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+constexpr size_t kRingCapacity = 16384;  // Power of two
+constexpr auto kCaptureDrainInterval = std::chrono::milliseconds(10);
+
+struct ZoneEvent {
+    uint32_t zone;
+    uint64_t start;
+    uint64_t end;
+};
+
+/**
+ * Single-producer single-consumer ring: the owning thread pushes, the
+ * collector drains under the registry mutex
+ */
+class ThreadRing {
+public:
+    explicit ThreadRing(uint32_t index) : index_(index), events_(std::make_unique<ZoneEvent[]>(kRingCapacity)) {}
+
+    bool Push(const ZoneEvent& event) noexcept {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == kRingCapacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        events_[head & (kRingCapacity - 1)] = event;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename Fn>
+    void Drain(Fn&& fn) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t head = head_.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            fn(events_[tail & (kRingCapacity - 1)]);
+        }
+        tail_.store(tail, std::memory_order_release);
+    }
+
+    const uint32_t index_;
+    std::atomic<bool> retired_{false};  // Owning thread exited
+    std::atomic<uint64_t> dropped_{0};
+
+private:
+    std::unique_ptr<ZoneEvent[]> events_;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+/**
+ * Log-linear histogram of durations in ticks: exact below 16, then 8
+ * sub-buckets per power of two, so a bucket spans at most 1/8 of its value
+ */
+class DurationHistogram {
+public:
+    using Buckets = LogLinearBuckets<3, 64>;
+    static constexpr size_t kBuckets = Buckets::kCount;
+
+    void Add(uint64_t value) noexcept { ++counts_[Buckets::Index(value)]; }
+
+    void Merge(const DurationHistogram& other) noexcept {
+        for (size_t i = 0; i < kBuckets; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+    }
+
+    // Midpoint of the bucket holding the q-quantile of count values
+    uint64_t Quantile(double q, uint64_t count) const noexcept {
+        size_t bucket = Buckets::FindRank(Buckets::Rank(q, count), [this](size_t i) { return counts_[i]; });
+        return bucket == kBuckets ? 0 : Buckets::Midpoint(bucket);
+    }
+
+private:
+    std::array<uint64_t, kBuckets> counts_{};
+};
+
+struct ZoneAccumulator {
+    uint64_t count{0};
+    uint64_t total{0};
+    uint64_t min{UINT64_MAX};
+    uint64_t max{0};
+    DurationHistogram histogram;
+
+    void Add(uint64_t ticks) noexcept {
+        ++count;
+        total += ticks;
+        min = std::min(min, ticks);
+        max = std::max(max, ticks);
+        histogram.Add(ticks);
+    }
+
+    void Merge(const ZoneAccumulator& other) noexcept {
+        count += other.count;
+        total += other.total;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        histogram.Merge(other.histogram);
+    }
+};
+
+struct TickSource {
+    bool tsc{false};
+    uint64_t tsc_origin{0};
+    std::chrono::steady_clock::time_point steady_origin;
+};
+
+bool HasInvariantTsc() {
+#ifdef VISION_INFRA_PROFILER_HAS_TSC
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) {
+        return false;
+    }
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+const TickSource& GetTickSource() {
+    static const TickSource source = [] {
+        TickSource detected;
+        detected.tsc = HasInvariantTsc();
+        detected.steady_origin = std::chrono::steady_clock::now();
+#ifdef VISION_INFRA_PROFILER_HAS_TSC
+        if (detected.tsc) {
+            detected.tsc_origin = __rdtsc();
+        }
+#endif
+        return detected;
+    }();
+    return source;
+}
+
+struct CapturedZone {
+    uint32_t thread;
+    ZoneEvent event;
+};
+
+class Registry {
+public:
+    std::mutex mutex_;
+    std::vector<std::string> zone_names_;
+    std::unordered_map<std::string, uint32_t> zone_ids_;
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+    uint32_t next_thread_index_{0};  // Indices are not reused, so captures never mix two threads
+    std::unordered_map<uint32_t, std::string> thread_names_;  // Named threads still running
+    // By (thread index, zone); exited threads are folded into kRetiredThreads
+    std::map<std::pair<uint32_t, uint32_t>, ZoneAccumulator> stats_;
+    uint64_t retired_dropped_{0};
+
+    // Timeline capture, guarded by mutex_
+    bool capturing_{false};
+    bool capture_stop_{false};
+    bool capture_enabled_profiler_{false};  // Profiling was off when the capture started
+    uint64_t capture_begin_{0};
+    uint64_t capture_end_{UINT64_MAX};
+    size_t capture_max_events_{0};
+    uint64_t capture_dropped_{0};
+    double capture_ns_per_tick_{1.0};  // Fixed when the capture ends so exports agree
+    std::vector<CapturedZone> captured_;
+    std::unordered_set<uint32_t> captured_threads_;  // Thread indices in captured_
+    std::unordered_map<uint32_t, std::string> captured_thread_names_;  // Of captured threads that exited
+    std::condition_variable capture_cv_;  // Stop requests and capture end
+
+    // Serializes StartCapture() and StopCapture(), which own capture_thread_
+    std::mutex capture_control_mutex_;
+    std::thread capture_thread_;
+
+    std::shared_ptr<ThreadRing> AddRing() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto ring = std::make_shared<ThreadRing>(next_thread_index_++);
+        rings_.push_back(ring);
+        return ring;
+    }
+
+    // Caller holds mutex_. Keeps the registry bounded under thread churn: the
+    // exited thread's statistics join the kRetiredThreads bucket and its name
+    // is dropped, unless a timeline capture still refers to it.
+    void RetireThread(uint32_t thread) {
+        auto first = stats_.lower_bound({thread, 0});
+        auto it = first;
+        for (; it != stats_.end() && it->first.first == thread; ++it) {
+            stats_[{ProfileZoneStats::kRetiredThreads, it->first.second}].Merge(it->second);
+        }
+        stats_.erase(first, it);
+
+        auto name = thread_names_.find(thread);
+        if (name != thread_names_.end()) {
+            if (captured_threads_.contains(thread)) {
+                captured_thread_names_.emplace(thread, std::move(name->second));
+            }
+            thread_names_.erase(name);
+        }
+    }
+
+    // Caller holds mutex_
+    template<typename Fn>
+    void DrainRings(Fn&& fn) {
+        for (auto it = rings_.begin(); it != rings_.end();) {
+            auto& ring = **it;
+            // Read before draining: a retired ring gets no more events
+            bool retired = ring.retired_.load(std::memory_order_acquire);
+            ring.Drain([&](const ZoneEvent& event) { fn(ring.index_, event); });
+            if (retired) {
+                retired_dropped_ += ring.dropped_.load(std::memory_order_relaxed);
+                uint32_t thread = ring.index_;
+                it = rings_.erase(it);
+                RetireThread(thread);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Caller holds mutex_
+    void Collect() {
+        DrainRings([this](uint32_t thread, const ZoneEvent& event) {
+            stats_[{thread, event.zone}].Add(event.end > event.start ? event.end - event.start : 0);
+            if (capturing_ && event.start >= capture_begin_ && event.end <= capture_end_) {
+                if (captured_.size() < capture_max_events_) {
+                    captured_.push_back({thread, event});
+                    captured_threads_.insert(thread);
+                } else {
+                    ++capture_dropped_;
+                }
+            }
+        });
+    }
+
+    // Capture thread: drain often enough that no ring fills, until stopped
+    // or past the deadline
+    void RunCapture(std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!capture_stop_) {
+            auto wake = std::min(std::chrono::steady_clock::now() + kCaptureDrainInterval, deadline);
+            capture_cv_.wait_until(lock, wake, [this] { return capture_stop_; });
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+            Collect();
+        }
+
+        capture_end_ = Profiler::Now();
+        Collect();
+        capture_ns_per_tick_ = Profiler::GetNanosecondsPerTick();
+        capturing_ = false;
+        if (capture_enabled_profiler_) {
+            Profiler::SetEnabled(false);
+        }
+        capture_cv_.notify_all();
+    }
+};
+
+// Leaked so that threads exiting during static destruction can still retire their rings
+Registry& GetRegistry() {
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+struct ThreadRingHandle {
+    std::shared_ptr<ThreadRing> ring;
+
+    ~ThreadRingHandle() {
+        if (ring) {
+            ring->retired_.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRingHandle t_ring;
+
+ThreadRing& CurrentRing() {
+    if (!t_ring.ring) {
+        t_ring.ring = GetRegistry().AddRing();
+    }
+    return *t_ring.ring;
+}
+
+void AppendJsonString(std::string& out, std::string_view text) {
+    out += '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+// Caller holds the registry mutex
+std::string ThreadNameLocked(const Registry& registry, uint32_t thread_index) {
+    if (thread_index == ProfileZoneStats::kRetiredThreads) {
+        return "retired threads";
+    }
+    auto it = registry.thread_names_.find(thread_index);
+    if (it != registry.thread_names_.end()) {
+        return it->second;
+    }
+    it = registry.captured_thread_names_.find(thread_index);
+    if (it != registry.captured_thread_names_.end()) {
+        return it->second;
+    }
+    return "thread " + std::to_string(thread_index);
+}
+
+#ifndef _WIN32
+struct CaptureSignal {
+    std::mutex mutex;
+    std::string path;
+    ProfileCaptureOptions options;
+    int pipe_read{-1};
+};
+
+// Leaked: the worker thread outlives static destruction
+CaptureSignal& GetCaptureSignal() {
+    static CaptureSignal* capture_signal = new CaptureSignal();
+    return *capture_signal;
+}
+
+// Self-pipe: write() is async-signal-safe, starting a capture is not
+std::atomic<int> g_capture_pipe_write{-1};
+
+void OnCaptureSignal(int) {
+    int saved_errno = errno;
+    char byte = 1;
+    [[maybe_unused]] auto written = ::write(g_capture_pipe_write.load(std::memory_order_relaxed), &byte, 1);
+    errno = saved_errno;
+}
+
+void CaptureSignalWorker(int fd) {
+    char buffer[64];
+    for (;;) {
+        ssize_t bytes = ::read(fd, buffer, sizeof(buffer));
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes <= 0) {
+            return;
+        }
+
+        std::string path;
+        ProfileCaptureOptions options;
+        {
+            auto& capture_signal = GetCaptureSignal();
+            std::lock_guard<std::mutex> lock(capture_signal.mutex);
+            path = capture_signal.path;
+            options = capture_signal.options;
+        }
+        // The file is only written once the capture ends, so it must end
+        if (options.duration.count() == 0) {
+            options.duration = ProfileCaptureOptions{}.duration;
+        }
+        if (Profiler::StartCapture(options)) {
+            auto& registry = GetRegistry();
+            {
+                std::unique_lock<std::mutex> lock(registry.mutex_);
+                registry.capture_cv_.wait(lock, [&registry] { return !registry.capturing_; });
+            }
+            Profiler::StopCapture();
+            Profiler::WriteChromeTrace(path);
+        }
+
+        // Signals received during the capture do not start another one
+        pollfd pending{fd, POLLIN, 0};
+        while (::poll(&pending, 1, 0) > 0 && ::read(fd, buffer, sizeof(buffer)) > 0) {
+        }
+    }
+}
+#endif
+
+} // namespace
+
+// Profiler implementation
+void Profiler::SetEnabled(bool enabled) noexcept {
+    if (enabled) {
+        GetTickSource();
+    }
+    detail::g_profiler_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint32_t Profiler::RegisterZone(std::string_view name) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    auto [it, inserted] = registry.zone_ids_.try_emplace(std::string(name),
+                                                         static_cast<uint32_t>(registry.zone_names_.size()));
+    if (inserted) {
+        registry.zone_names_.emplace_back(name);
+    }
+    return it->second;
+}
+
+void Profiler::SetThreadName(std::string_view name) {
+    uint32_t index = CurrentRing().index_;
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.thread_names_[index] = name;
+}
+
+std::string Profiler::GetThreadName(uint32_t thread_index) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    return ThreadNameLocked(registry, thread_index);
+}
+
+uint64_t Profiler::Now() noexcept {
+#ifdef VISION_INFRA_PROFILER_HAS_TSC
+    if (GetTickSource().tsc) {
+        return __rdtsc();
+    }
+#endif
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+bool Profiler::UsesTsc() noexcept {
+    return GetTickSource().tsc;
+}
+
+double Profiler::GetNanosecondsPerTick() {
+    const auto& source = GetTickSource();
+    if (!source.tsc) {
+        return 1.0;
+    }
+
+    // The longer the process has run, the better the estimate; once it has
+    // run for a second the rate is fixed
+    static std::atomic<double> calibrated{0.0};
+    double cached = calibrated.load(std::memory_order_relaxed);
+    if (cached > 0.0) {
+        return cached;
+    }
+
+    constexpr auto kMinimum = std::chrono::milliseconds(10);
+    auto elapsed = std::chrono::steady_clock::now() - source.steady_origin;
+    if (elapsed < kMinimum) {
+        std::this_thread::sleep_for(kMinimum - elapsed);
+    }
+    uint64_t ticks = Now() - source.tsc_origin;
+    elapsed = std::chrono::steady_clock::now() - source.steady_origin;
+    double rate = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                  static_cast<double>(std::max<uint64_t>(ticks, 1));
+    if (elapsed >= std::chrono::seconds(1)) {
+        calibrated.store(rate, std::memory_order_relaxed);
+    }
+    return rate;
+}
+
+void Profiler::Record(uint32_t zone, uint64_t start_ticks, uint64_t end_ticks) noexcept {
+    try {
+        CurrentRing().Push({zone, start_ticks, end_ticks});
+    } catch (...) {
+        // No ring could be allocated for this thread; the zone is lost
+    }
+}
+
+std::vector<ProfileZoneStats> Profiler::GetStats(bool per_thread) {
+    double ms_per_tick = GetNanosecondsPerTick() / 1e6;
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.Collect();
+
+    std::map<std::pair<uint32_t, uint32_t>, ZoneAccumulator> merged;
+    const auto* source = &registry.stats_;
+    if (!per_thread) {
+        for (const auto& [key, accumulator] : registry.stats_) {
+            merged[{ProfileZoneStats::kAllThreads, key.second}].Merge(accumulator);
+        }
+        source = &merged;
+    }
+
+    std::vector<ProfileZoneStats> result;
+    result.reserve(source->size());
+    for (const auto& [key, accumulator] : *source) {
+        ProfileZoneStats stats;
+        stats.name = registry.zone_names_[key.second];
+        stats.thread_index = key.first;
+        stats.count = accumulator.count;
+        stats.total_ms = static_cast<double>(accumulator.total) * ms_per_tick;
+        stats.min_ms = static_cast<double>(accumulator.min) * ms_per_tick;
+        stats.max_ms = static_cast<double>(accumulator.max) * ms_per_tick;
+        auto quantile = [&](double q) {
+            uint64_t ticks = accumulator.histogram.Quantile(q, accumulator.count);
+            return static_cast<double>(std::clamp(ticks, accumulator.min, accumulator.max)) * ms_per_tick;
+        };
+        stats.p50_ms = quantile(0.50);
+        stats.p90_ms = quantile(0.90);
+        stats.p99_ms = quantile(0.99);
+        result.push_back(std::move(stats));
+    }
+    std::sort(result.begin(), result.end(), [](const ProfileZoneStats& a, const ProfileZoneStats& b) {
+        return a.total_ms > b.total_ms;
+    });
+    return result;
+}
+
+uint64_t Profiler::GetDroppedCount() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    uint64_t dropped = registry.retired_dropped_;
+    for (const auto& ring : registry.rings_) {
+        dropped += ring->dropped_.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void Profiler::Reset() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.DrainRings([](uint32_t, const ZoneEvent&) {});
+    registry.stats_.clear();
+    registry.retired_dropped_ = 0;
+    for (const auto& ring : registry.rings_) {
+        ring->dropped_.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string Profiler::FormatReport(bool per_thread) {
+    auto stats = GetStats(per_thread);
+    std::string report;
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-32s %-16s %10s %12s %10s %10s %10s %10s %10s\n", "zone", "thread", "count",
+                  "total ms", "mean ms", "p50 ms", "p90 ms", "p99 ms", "max ms");
+    report += line;
+    for (const auto& zone : stats) {
+        std::string thread = zone.thread_index == ProfileZoneStats::kAllThreads ? "all" : GetThreadName(zone.thread_index);
+        std::snprintf(line, sizeof(line), "%-32s %-16s %10llu %12.3f %10.4f %10.4f %10.4f %10.4f %10.4f\n",
+                      zone.name.c_str(), thread.c_str(), static_cast<unsigned long long>(zone.count), zone.total_ms,
+                      zone.GetMeanMs(), zone.p50_ms, zone.p90_ms, zone.p99_ms, zone.max_ms);
+        report += line;
+    }
+    uint64_t dropped = GetDroppedCount();
+    if (dropped > 0) {
+        report += "dropped zones: " + std::to_string(dropped) + "\n";
+    }
+    return report;
+}
+
+bool Profiler::StartCapture(const ProfileCaptureOptions& options) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> control(registry.capture_control_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        if (registry.capturing_) {
+            return false;
+        }
+    }
+    // A capture that ended on its own leaves its thread to join
+    if (registry.capture_thread_.joinable()) {
+        registry.capture_thread_.join();
+    }
+
+    auto deadline = options.duration.count() > 0 ? std::chrono::steady_clock::now() + options.duration
+                                                 : std::chrono::steady_clock::time_point::max();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        registry.capture_enabled_profiler_ = !IsEnabled();
+        SetEnabled(true);
+        // Zones finished before the capture only count towards the statistics
+        registry.Collect();
+        registry.captured_.clear();
+        registry.captured_threads_.clear();
+        registry.captured_thread_names_.clear();
+        registry.capture_dropped_ = 0;
+        registry.capture_max_events_ = options.max_events;
+        registry.capture_begin_ = Now();
+        registry.capture_end_ = UINT64_MAX;
+        registry.capture_stop_ = false;
+        registry.capturing_ = true;
+    }
+    registry.capture_thread_ = std::thread([&registry, deadline] { registry.RunCapture(deadline); });
+    return true;
+}
+
+void Profiler::StopCapture() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> control(registry.capture_control_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        registry.capture_stop_ = true;
+    }
+    registry.capture_cv_.notify_all();
+    if (registry.capture_thread_.joinable()) {
+        registry.capture_thread_.join();
+    }
+}
+
+bool Profiler::IsCapturing() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    return registry.capturing_;
+}
+
+std::string Profiler::FormatChromeTrace() {
+    double live_ns_per_tick = GetNanosecondsPerTick();
+#ifdef _WIN32
+    int pid = _getpid();
+#else
+    int pid = static_cast<int>(::getpid());
+#endif
+
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    if (registry.capturing_) {
+        registry.Collect();
+    }
+    double us_per_tick = (registry.capturing_ ? live_ns_per_tick : registry.capture_ns_per_tick_) / 1e3;
+
+    // Per thread by start time, enclosing zones before the zones they contain
+    std::vector<CapturedZone> zones = registry.captured_;
+    std::sort(zones.begin(), zones.end(), [](const CapturedZone& a, const CapturedZone& b) {
+        if (a.thread != b.thread) {
+            return a.thread < b.thread;
+        }
+        if (a.event.start != b.event.start) {
+            return a.event.start < b.event.start;
+        }
+        return a.event.end > b.event.end;
+    });
+
+    std::string trace;
+    trace.reserve(256 + zones.size() * 96);
+    char field[128];
+    trace += "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_zones\":\"";
+    trace += std::to_string(registry.capture_dropped_);
+    trace += "\"},\"traceEvents\":[\n";
+
+    std::snprintf(field, sizeof(field), "\"pid\":%d", pid);
+    std::string pid_field = field;
+    trace += "{\"name\":\"process_name\",\"ph\":\"M\"," + pid_field + ",\"tid\":0,\"args\":{\"name\":\"vision-infra\"}}";
+
+    uint32_t last_thread = ProfileZoneStats::kAllThreads;
+    for (const auto& zone : zones) {
+        if (zone.thread != last_thread) {
+            last_thread = zone.thread;
+            trace += ",\n{\"name\":\"thread_name\",\"ph\":\"M\"," + pid_field + ",\"tid\":" + std::to_string(zone.thread) +
+                     ",\"args\":{\"name\":";
+            AppendJsonString(trace, ThreadNameLocked(registry, zone.thread));
+            trace += "}}";
+        }
+
+        trace += ",\n{\"name\":";
+        AppendJsonString(trace, registry.zone_names_[zone.event.zone]);
+        uint64_t duration = zone.event.end > zone.event.start ? zone.event.end - zone.event.start : 0;
+        std::snprintf(field, sizeof(field), ",\"cat\":\"vision-infra\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,",
+                      static_cast<double>(zone.event.start - registry.capture_begin_) * us_per_tick,
+                      static_cast<double>(duration) * us_per_tick);
+        trace += field;
+        trace += pid_field + ",\"tid\":" + std::to_string(zone.thread) + "}";
+    }
+    trace += "\n]}\n";
+    return trace;
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) {
+    FileWriteOptions options;
+    options.atomic = true;
+    auto writer = FileWriter::Open(path, options);
+    return writer.has_value() && writer->Write(FormatChromeTrace()) && writer->Commit();
+}
+
+bool Profiler::InstallCaptureSignal(int signum, const std::string& path, const ProfileCaptureOptions& options) {
+#ifdef _WIN32
+    (void)signum;
+    (void)path;
+    (void)options;
+    return false;
+#else
+    auto& capture_signal = GetCaptureSignal();
+    std::lock_guard<std::mutex> lock(capture_signal.mutex);
+    if (capture_signal.pipe_read < 0) {
+        int fds[2];
+        if (::pipe(fds) != 0) {
+            return false;
+        }
+        ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+        // A full pipe must not block the handler; a capture is pending anyway
+        ::fcntl(fds[1], F_SETFL, O_NONBLOCK);
+        capture_signal.pipe_read = fds[0];
+        g_capture_pipe_write.store(fds[1], std::memory_order_relaxed);
+        std::thread(CaptureSignalWorker, fds[0]).detach();
+    }
+    capture_signal.path = path;
+    capture_signal.options = options;
+
+    struct sigaction action {};
+    action.sa_handler = OnCaptureSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    return ::sigaction(signum, &action, nullptr) == 0;
+#endif
+}
+
+} // namespace core
+} // namespace vision_infra
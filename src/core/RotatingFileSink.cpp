@@ -0,0 +1,177 @@
+#include "vision-infra/core/RotatingFileSink.hpp"
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+
+namespace vision_infra {
+namespace core {
+
+// RotatingFileSink::Impl (PIMPL implementation)
+class RotatingFileSink::Impl {
+public:
+    std::string path_;
+    FileSinkOptions options_;
+    std::ofstream stream_;
+    std::string buffer_;
+    MemoryCharge buffer_charge_{MemoryTag::LOGGING};
+    uint64_t file_size_{0};
+    std::chrono::steady_clock::time_point last_flush_;
+    std::chrono::system_clock::time_point next_rotation_;
+    uint64_t rotation_offset_{0};  // Bytes written before a failed rotation; not counted again
+    std::string last_error_;
+
+    // Opens path_ for appending (or truncated) into stream
+    bool OpenStream(std::ofstream& stream, std::ios::openmode mode = std::ios::app) const {
+        // The sink does its own buffering; each flush is a single write
+        stream.rdbuf()->pubsetbuf(nullptr, 0);
+        stream.open(path_, std::ios::binary | mode);
+        return stream.is_open();
+    }
+
+    // Resets the size and timers for the file stream_ now writes to
+    void StartFile() {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(path_, ec);
+        file_size_ = ec ? 0 : size;
+        rotation_offset_ = 0;
+        last_flush_ = std::chrono::steady_clock::now();
+        ScheduleRotation();
+    }
+
+    void ScheduleRotation() {
+        if (options_.rotation_interval.count() > 0) {
+            next_rotation_ = std::chrono::system_clock::now() + options_.rotation_interval;
+        }
+    }
+
+    void WriteBuffer() {
+        if (!buffer_.empty()) {
+            stream_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+        stream_.flush();
+        last_flush_ = std::chrono::steady_clock::now();
+    }
+
+    bool FlushDue(std::chrono::steady_clock::time_point now) const {
+        return now - last_flush_ >= options_.flush_interval;
+    }
+
+    bool NeedsRotation(size_t incoming) const {
+        const uint64_t written = file_size_ - rotation_offset_;
+        if (options_.max_file_size > 0 && written > 0 && written + incoming > options_.max_file_size) {
+            return true;
+        }
+        return options_.rotation_interval.count() > 0 && std::chrono::system_clock::now() >= next_rotation_;
+    }
+};
+
+// RotatingFileSink implementation
+RotatingFileSink::RotatingFileSink(const std::string& path, const FileSinkOptions& options)
+    : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->path_ = path;
+    pImpl_->options_ = options;
+    pImpl_->buffer_.reserve(options.buffer_size);
+    pImpl_->buffer_charge_.Allocate(pImpl_->buffer_.capacity());
+    if (!pImpl_->OpenStream(pImpl_->stream_)) {
+        throw std::runtime_error("Cannot open log file: " + path);
+    }
+    pImpl_->StartFile();
+}
+
+RotatingFileSink::~RotatingFileSink() {
+    pImpl_->WriteBuffer();
+}
+
+void RotatingFileSink::Write(std::string_view line, LogLevel level) {
+    auto& impl = *pImpl_;
+    if (impl.NeedsRotation(line.size())) {
+        Rotate();
+    }
+
+    if (impl.buffer_.size() + line.size() > impl.options_.buffer_size) {
+        impl.WriteBuffer();
+    }
+    impl.buffer_.append(line);
+    impl.file_size_ += line.size();
+
+    if (level >= impl.options_.flush_level || impl.FlushDue(std::chrono::steady_clock::now())) {
+        impl.WriteBuffer();
+    }
+}
+
+void RotatingFileSink::Flush() {
+    pImpl_->WriteBuffer();
+}
+
+void RotatingFileSink::FlushIfDue() {
+    if (!pImpl_->buffer_.empty() && pImpl_->FlushDue(std::chrono::steady_clock::now())) {
+        pImpl_->WriteBuffer();
+    }
+}
+
+std::optional<std::chrono::steady_clock::time_point> RotatingFileSink::GetFlushDeadline() const noexcept {
+    if (pImpl_->buffer_.empty()) {
+        return std::nullopt;
+    }
+    return pImpl_->last_flush_ + pImpl_->options_.flush_interval;
+}
+
+void RotatingFileSink::Rotate() {
+    auto& impl = *pImpl_;
+    impl.WriteBuffer();
+
+    // The current stream stays open until its successor is, so a failed open
+    // never leaves the sink without a file
+    std::error_code ec;
+    std::ofstream next;
+    bool opened = false;
+    if (impl.options_.max_files == 0) {
+        opened = impl.OpenStream(next, std::ios::trunc);
+    } else {
+        std::filesystem::remove(RotatedPath(impl.path_, impl.options_.max_files), ec);
+        for (size_t index = impl.options_.max_files - 1; index >= 1; --index) {
+            auto from = RotatedPath(impl.path_, index);
+            if (std::filesystem::exists(from, ec)) {
+                std::filesystem::rename(from, RotatedPath(impl.path_, index + 1), ec);
+            }
+        }
+        std::filesystem::rename(impl.path_, RotatedPath(impl.path_, 1), ec);
+        opened = impl.OpenStream(next);
+    }
+
+    if (!opened) {
+        // Keep writing to the old file and retry after another full period
+        impl.last_error_ = "Cannot open log file after rotation: " + impl.path_;
+        std::cerr << impl.last_error_ << std::endl;
+        impl.rotation_offset_ = impl.file_size_;
+        impl.ScheduleRotation();
+        return;
+    }
+    impl.stream_ = std::move(next);
+    impl.StartFile();
+}
+
+const std::string& RotatingFileSink::GetPath() const noexcept {
+    return pImpl_->path_;
+}
+
+uint64_t RotatingFileSink::GetFileSize() const noexcept {
+    return pImpl_->file_size_;
+}
+
+const std::string& RotatingFileSink::GetLastError() const noexcept {
+    return pImpl_->last_error_;
+}
+
+std::string RotatingFileSink::RotatedPath(const std::string& path, size_t index) {
+    std::filesystem::path file(path);
+    auto rotated = file.stem().string() + "." + std::to_string(index) + file.extension().string();
+    return (file.parent_path() / rotated).string();
+}
+
+} // namespace core
+} // namespace vision_infra
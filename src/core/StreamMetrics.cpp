@@ -0,0 +1,225 @@
+#include "vision-infra/core/StreamMetrics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace vision_infra {
+namespace core {
+
+namespace {
+
+int64_t SteadyNowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+double Seconds(int64_t nanoseconds) noexcept {
+    return static_cast<double>(nanoseconds) / 1e9;
+}
+
+struct Stream {
+    Stream(uint32_t stream_id, std::string stream_name, int64_t now)
+        : id(stream_id), name(std::move(stream_name)), registered_ns(now), previous_ns(now) {}
+
+    const uint32_t id;
+    const std::string name;
+    const int64_t registered_ns;
+
+    // Written by recording threads, on lines of their own
+    alignas(64) std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<int64_t> last_frame_ns{0};  // 0 until the first frame
+    alignas(64) LatencyHistogram latency;
+
+    // Snapshot() state, guarded by the snapshot mutex
+    alignas(64) uint64_t previous_frames{0};
+    int64_t previous_ns;
+};
+
+} // namespace
+
+// StreamMetrics::Impl (PIMPL implementation)
+class StreamMetrics::Impl {
+public:
+    StreamMetricsOptions options_;
+
+    // Registration
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Stream>> streams_;
+    std::unordered_map<std::string, StreamId> ids_;
+
+    // Lock-free lookup for recorders: slots_[id] is published once the
+    // stream is fully constructed, and stays valid until destruction
+    std::unique_ptr<std::atomic<Stream*>[]> slots_;
+    std::atomic<size_t> published_{0};
+
+    std::mutex snapshot_mutex_;
+
+    Stream* Find(StreamId id) const noexcept {
+        return id < options_.max_streams ? slots_[id].load(std::memory_order_acquire) : nullptr;
+    }
+};
+
+// StreamMetrics implementation
+StreamMetrics::StreamMetrics(const StreamMetricsOptions& options) : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->options_ = options;
+    pImpl_->slots_ = std::make_unique<std::atomic<Stream*>[]>(options.max_streams);
+    pImpl_->streams_.reserve(options.max_streams);
+}
+
+StreamMetrics::~StreamMetrics() = default;
+
+StreamMetrics::StreamId StreamMetrics::RegisterStream(const std::string& name) {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    auto it = pImpl_->ids_.find(name);
+    if (it != pImpl_->ids_.end()) {
+        return it->second;
+    }
+    if (pImpl_->streams_.size() >= pImpl_->options_.max_streams) {
+        throw std::runtime_error("StreamMetrics: cannot register more than " +
+                                 std::to_string(pImpl_->options_.max_streams) + " streams");
+    }
+
+    auto id = static_cast<StreamId>(pImpl_->streams_.size());
+    pImpl_->streams_.push_back(std::make_unique<Stream>(id, name, SteadyNowNs()));
+    pImpl_->ids_.emplace(name, id);
+    pImpl_->slots_[id].store(pImpl_->streams_.back().get(), std::memory_order_release);
+    pImpl_->published_.store(pImpl_->streams_.size(), std::memory_order_release);
+    return id;
+}
+
+void StreamMetrics::RecordFrame(StreamId id) noexcept {
+    if (auto* stream = pImpl_->Find(id)) {
+        stream->frames.fetch_add(1, std::memory_order_relaxed);
+        stream->last_frame_ns.store(SteadyNowNs(), std::memory_order_relaxed);
+    }
+}
+
+void StreamMetrics::RecordFrame(StreamId id, std::chrono::nanoseconds latency) noexcept {
+    if (auto* stream = pImpl_->Find(id)) {
+        stream->frames.fetch_add(1, std::memory_order_relaxed);
+        stream->last_frame_ns.store(SteadyNowNs(), std::memory_order_relaxed);
+        stream->latency.Record(latency);
+    }
+}
+
+void StreamMetrics::RecordDrop(StreamId id) noexcept {
+    if (auto* stream = pImpl_->Find(id)) {
+        stream->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+StreamMetricsSnapshot StreamMetrics::Snapshot(bool include_latency) {
+    std::lock_guard<std::mutex> lock(pImpl_->snapshot_mutex_);
+    size_t count = pImpl_->published_.load(std::memory_order_acquire);
+    int64_t stall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(pImpl_->options_.stall_timeout).count();
+
+    StreamMetricsSnapshot snapshot;
+    snapshot.streams.reserve(count);
+    LatencyHistogram merged;
+    for (size_t id = 0; id < count; ++id) {
+        Stream& stream = *pImpl_->slots_[id].load(std::memory_order_acquire);
+        int64_t now = SteadyNowNs();
+
+        StreamStats stats;
+        stats.id = stream.id;
+        stats.name = stream.name;
+        stats.frames = stream.frames.load(std::memory_order_relaxed);
+        stats.dropped = stream.dropped.load(std::memory_order_relaxed);
+
+        int64_t interval = now - stream.previous_ns;
+        if (interval > 0) {
+            stats.fps = static_cast<double>(stats.frames - stream.previous_frames) / Seconds(interval);
+        }
+        stream.previous_frames = stats.frames;
+        stream.previous_ns = now;
+        if (now > stream.registered_ns) {
+            stats.average_fps = static_cast<double>(stats.frames) / Seconds(now - stream.registered_ns);
+        }
+
+        int64_t last_frame = stream.last_frame_ns.load(std::memory_order_relaxed);
+        int64_t quiet = std::max<int64_t>(now - (last_frame != 0 ? last_frame : stream.registered_ns), 0);
+        stats.ms_since_last_frame = static_cast<double>(quiet) / 1e6;
+        stats.stalled = quiet >= stall_ns;
+
+        if (include_latency) {
+            stats.latency = stream.latency.GetStats();
+            merged.Merge(stream.latency);
+        }
+
+        snapshot.total_frames += stats.frames;
+        snapshot.total_dropped += stats.dropped;
+        snapshot.total_fps += stats.fps;
+        snapshot.stalled_streams += stats.stalled ? 1 : 0;
+        snapshot.streams.push_back(std::move(stats));
+    }
+    if (include_latency) {
+        snapshot.latency = merged.GetStats();
+    }
+    return snapshot;
+}
+
+void StreamMetrics::ResetLatency() {
+    size_t count = pImpl_->published_.load(std::memory_order_acquire);
+    for (size_t id = 0; id < count; ++id) {
+        pImpl_->slots_[id].load(std::memory_order_acquire)->latency.Reset();
+    }
+}
+
+size_t StreamMetrics::GetStreamCount() const {
+    return pImpl_->published_.load(std::memory_order_acquire);
+}
+
+std::string StreamMetrics::FormatSnapshot(const StreamMetricsSnapshot& snapshot, size_t slowest) {
+    std::string report;
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "streams: %zu  stalled: %zu  frames: %llu  dropped: %llu  fps: %.1f  latency p50/p99/max ms: "
+                  "%.2f/%.2f/%.2f\n",
+                  snapshot.streams.size(), snapshot.stalled_streams,
+                  static_cast<unsigned long long>(snapshot.total_frames),
+                  static_cast<unsigned long long>(snapshot.total_dropped), snapshot.total_fps,
+                  snapshot.latency.p50_ms, snapshot.latency.p99_ms, snapshot.latency.max_ms);
+    report += line;
+
+    auto streams = snapshot.GetSlowest(slowest);
+    if (streams.empty()) {
+        return report;
+    }
+    std::snprintf(line, sizeof(line), "%-6s %-24s %10s %10s %14s %10s %10s %8s\n", "id", "stream", "fps", "avg fps",
+                  "last frame ms", "p99 ms", "dropped", "state");
+    report += line;
+    for (const auto& stream : streams) {
+        std::snprintf(line, sizeof(line), "%-6u %-24s %10.2f %10.2f %14.1f %10.2f %10llu %8s\n", stream.id,
+                      stream.name.c_str(), stream.fps, stream.average_fps, stream.ms_since_last_frame,
+                      stream.latency.p99_ms, static_cast<unsigned long long>(stream.dropped),
+                      stream.stalled ? "STALLED" : "ok");
+        report += line;
+    }
+    return report;
+}
+
+// StreamMetricsSnapshot implementation
+std::vector<StreamStats> StreamMetricsSnapshot::GetSlowest(size_t n) const {
+    std::vector<StreamStats> slowest = streams;
+    n = std::min(n, slowest.size());
+    std::partial_sort(slowest.begin(), slowest.begin() + static_cast<std::ptrdiff_t>(n), slowest.end(),
+                      [](const StreamStats& a, const StreamStats& b) {
+                          if (a.stalled != b.stalled) {
+                              return a.stalled;
+                          }
+                          if (a.fps != b.fps) {
+                              return a.fps < b.fps;
+                          }
+                          return a.id < b.id;
+                      });
+    slowest.resize(n);
+    return slowest;
+}
+
+} // namespace core
+} // namespace vision_infra
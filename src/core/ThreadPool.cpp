@@ -0,0 +1,132 @@
+#include "vision-infra/core/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vision_infra {
+namespace core {
+
+// ThreadPool::Impl (PIMPL implementation)
+class ThreadPool::Impl {
+public:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    bool stopping_{false};
+
+    void WorkerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                queue_cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+// Shared between the caller and helper tasks of one ParallelFor call. Helpers
+// that start after all indices were claimed never touch fn, so the caller only
+// waits for completed indices, not for helpers to be scheduled.
+struct ParallelForState {
+    std::atomic<size_t> next;
+    std::atomic<size_t> remaining;
+    size_t end;
+    const std::function<void(size_t)>* fn;
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    std::exception_ptr error;
+
+    ParallelForState(size_t begin, size_t end_index, const std::function<void(size_t)>* func)
+        : next(begin), remaining(end_index - begin), end(end_index), fn(func) {}
+
+    void Run() {
+        for (;;) {
+            size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= end) {
+                return;
+            }
+            try {
+                (*fn)(index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(mutex);
+                done_cv.notify_all();
+            }
+        }
+    }
+};
+
+// ThreadPool implementation
+ThreadPool::ThreadPool(size_t num_threads) : pImpl_(std::make_unique<Impl>()) {
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    pImpl_->workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        pImpl_->workers_.emplace_back([impl = pImpl_.get()] { impl->WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->queue_mutex_);
+        pImpl_->stopping_ = true;
+    }
+    pImpl_->queue_cv_.notify_all();
+    for (auto& worker : pImpl_->workers_) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::GetNumThreads() const noexcept {
+    return pImpl_->workers_.size();
+}
+
+void ThreadPool::Enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->queue_mutex_);
+        pImpl_->tasks_.push_back(std::move(task));
+    }
+    pImpl_->queue_cv_.notify_one();
+}
+
+void ThreadPool::ParallelFor(size_t begin, size_t end, const std::function<void(size_t)>& fn) {
+    if (begin >= end) {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(begin, end, &fn);
+    size_t helpers = std::min(GetNumThreads(), end - begin - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        Enqueue([state] { state->Run(); });
+    }
+
+    state->Run();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done_cv.wait(lock, [&state] { return state->remaining.load(std::memory_order_acquire) == 0; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} // namespace core
+} // namespace vision_infra
@@ -0,0 +1,211 @@
+#include "vision-infra/utils/DatasetLoader.hpp"
+#include "vision-infra/core/DirectoryScanner.hpp"
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace vision_infra {
+namespace utils {
+
+namespace {
+
+// Channels cv::imdecode produces under decode_flags; when the flags keep the
+// file's own layout, the most it can have (BGRA)
+int MaxDecodedChannels(int decode_flags) {
+    if (decode_flags < 0 || (decode_flags & cv::IMREAD_ANYCOLOR) != 0) {
+        return 4;
+    }
+    return (decode_flags & cv::IMREAD_COLOR) != 0 ? 3 : 1;
+}
+
+} // namespace
+
+// DatasetLoader::Impl (PIMPL implementation)
+class DatasetLoader::Impl {
+public:
+    std::vector<std::string> paths_;
+    DatasetLoaderOptions options_;
+    core::ThreadPool* pool_{nullptr};
+    std::shared_ptr<core::AsyncFileIO> io_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<size_t, DatasetSample> ready_;  // Finished samples by index
+    size_t next_issue_{0};
+    size_t next_deliver_{0};                // Next index in ordered mode
+    size_t delivered_{0};
+    size_t outstanding_{0};                 // Issued but not yet in ready_
+    std::atomic<bool> stopping_{false};
+    core::MemoryCharge charge_{core::MemoryTag::DATASET};  // Tensors of samples in ready_
+
+    // Called with mutex_ held; the read itself is started after unlocking
+    std::optional<size_t> TakeIssueSlot() {
+        if (next_issue_ >= paths_.size()) {
+            return std::nullopt;
+        }
+        ++outstanding_;
+        return next_issue_++;
+    }
+
+    void StartRead(size_t index) {
+        io_->ReadFile(paths_[index], [this, index](std::optional<std::vector<uint8_t>> bytes) {
+            // Leave the I/O thread free for completions; decoding is CPU work
+            pool_->Submit([this, index, bytes = std::move(bytes)]() mutable { Process(index, std::move(bytes)); });
+        });
+    }
+
+    void Process(size_t index, std::optional<std::vector<uint8_t>> bytes) {
+        DatasetSample sample;
+        sample.index = index;
+        sample.path = paths_[index];
+        if (bytes && !bytes->empty() && !stopping_.load(std::memory_order_relaxed)) {
+            try {
+                cv::Mat encoded(1, static_cast<int>(bytes->size()), CV_8UC1, bytes->data());
+                cv::Mat image = cv::imdecode(encoded, options_.decode_flags);
+                if (!image.empty()) {
+                    sample.channels = image.channels();
+                    sample.original_size = image.size();
+                    sample.tensor.resize(static_cast<size_t>(sample.channels) *
+                                         static_cast<size_t>(options_.preprocess.target_size.area()));
+                    sample.letterbox = ImageUtils::PreprocessToChw(image, options_.preprocess,
+                                                                   std::span<float>(sample.tensor));
+                    sample.ok = true;
+                }
+            } catch (const std::exception&) {
+                // Unsupported or corrupt image: delivered as a failed sample
+            }
+            if (!sample.ok) {
+                sample.tensor.clear();
+                sample.channels = 0;
+            }
+        }
+
+        size_t tensor_bytes = sample.tensor.size() * sizeof(float);
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.emplace(index, std::move(sample));
+        charge_.Allocate(tensor_bytes);
+        --outstanding_;
+        // Notify under the lock: the destructor may be waiting to tear the loader down
+        cv_.notify_all();
+    }
+};
+
+// DatasetLoader implementation
+DatasetLoader::DatasetLoader(std::vector<std::string> paths, const DatasetLoaderOptions& options,
+                             core::ThreadPool& pool, std::shared_ptr<core::AsyncFileIO> io)
+    : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->paths_ = std::move(paths);
+    pImpl_->options_ = options;
+    pImpl_->options_.prefetch_depth = std::max<size_t>(options.prefetch_depth, 1);
+    pImpl_->pool_ = &pool;
+    pImpl_->io_ = io ? std::move(io) : core::AsyncFileIO::GetDefault();
+
+    std::vector<size_t> initial;
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+        while (initial.size() < pImpl_->options_.prefetch_depth) {
+            auto index = pImpl_->TakeIssueSlot();
+            if (!index) {
+                break;
+            }
+            initial.push_back(*index);
+        }
+    }
+    for (size_t index : initial) {
+        pImpl_->StartRead(index);
+    }
+}
+
+DatasetLoader::~DatasetLoader() {
+    auto& impl = *pImpl_;
+    impl.stopping_.store(true, std::memory_order_relaxed);
+    std::unique_lock<std::mutex> lock(impl.mutex_);
+    impl.cv_.wait(lock, [&impl] { return impl.outstanding_ == 0; });
+}
+
+std::vector<std::string> DatasetLoader::FindImages(const std::string& directory, core::ThreadPool& pool,
+                                                   bool recursive) {
+    core::ScanOptions options;
+    options.recursive = recursive;
+    options.media_types = {core::MediaType::IMAGE};
+    return core::DirectoryScanner(options).ScanAll(directory, pool);
+}
+
+bool DatasetLoader::Next(DatasetSample& sample) {
+    auto& impl = *pImpl_;
+    std::optional<size_t> refill;
+    {
+        std::unique_lock<std::mutex> lock(impl.mutex_);
+        if (impl.delivered_ == impl.paths_.size()) {
+            return false;
+        }
+
+        auto ready = [&impl]() {
+            return impl.options_.ordered ? impl.ready_.find(impl.next_deliver_) : impl.ready_.begin();
+        };
+        impl.cv_.wait(lock, [&]() { return ready() != impl.ready_.end(); });
+
+        auto it = ready();
+        sample = std::move(it->second);
+        impl.ready_.erase(it);
+        impl.charge_.Free(sample.tensor.size() * sizeof(float));
+        ++impl.delivered_;
+        if (impl.options_.ordered) {
+            ++impl.next_deliver_;
+        }
+        refill = impl.TakeIssueSlot();
+    }
+
+    if (refill) {
+        impl.StartRead(*refill);
+    }
+    return true;
+}
+
+size_t DatasetLoader::NextBatch(size_t batch_size, std::span<float> output, std::vector<DatasetSample>& samples) {
+    samples.clear();
+    // Checked before any sample is taken, so a bad buffer loses no samples
+    const size_t max_image_size = static_cast<size_t>(MaxDecodedChannels(pImpl_->options_.decode_flags)) *
+                                  static_cast<size_t>(pImpl_->options_.preprocess.target_size.area());
+    if (max_image_size != 0 && output.size() / max_image_size < batch_size) {
+        throw std::invalid_argument("NextBatch: output buffer is too small");
+    }
+
+    size_t written = 0;
+    size_t image_size = 0;
+    DatasetSample sample;
+    while (written < batch_size && Next(sample)) {
+        if (sample.ok) {
+            if (written == 0) {
+                image_size = sample.tensor.size();
+            } else if (sample.tensor.size() != image_size) {
+                throw std::invalid_argument("NextBatch: all images must have the same channel count");
+            }
+            std::copy(sample.tensor.begin(), sample.tensor.end(),
+                      output.begin() + static_cast<std::ptrdiff_t>(written * image_size));
+            ++written;
+        }
+        sample.tensor = {};
+        samples.push_back(std::move(sample));
+    }
+
+    // Zero the batch slots that were not filled
+    if (written > 0) {
+        std::fill(output.begin() + static_cast<std::ptrdiff_t>(written * image_size),
+                  output.begin() + static_cast<std::ptrdiff_t>(batch_size * image_size), 0.0f);
+    }
+    return written;
+}
+
+size_t DatasetLoader::Size() const noexcept {
+    return pImpl_->paths_.size();
+}
+
+} // namespace utils
+} // namespace vision_infra
@@ -0,0 +1,238 @@
+#include "vision-infra/utils/ImageCache.hpp"
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include <bit>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+namespace vision_infra {
+namespace utils {
+
+namespace {
+
+using FileTime = std::filesystem::file_time_type;
+
+std::optional<FileTime> ModificationTime(const std::string& path) {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return time;
+}
+
+// Keys start with the path and a newline, which cannot be confused with the
+// rest; floats are keyed by their bit patterns so that any change is a new key
+std::string ImageKey(const std::string& path, int decode_flags) {
+    return path + "\nimage " + std::to_string(decode_flags);
+}
+
+std::string TensorKey(const std::string& path, const ImageUtils::PreprocessOptions& options, int decode_flags) {
+    std::string key = path + "\ntensor " + std::to_string(decode_flags);
+    auto append = [&key](auto value) {
+        key += ' ';
+        key += std::to_string(value);
+    };
+    auto append_float = [&append](float value) { append(std::bit_cast<uint32_t>(value)); };
+
+    append(options.target_size.width);
+    append(options.target_size.height);
+    append_float(options.scale);
+    append(options.swap_rb ? 1 : 0);
+    for (int c = 0; c < 4; ++c) {
+        append(std::bit_cast<uint64_t>(options.fill_color[c]));
+    }
+    key += " m";
+    for (float value : options.mean) {
+        append_float(value);
+    }
+    key += " s";
+    for (float value : options.std) {
+        append_float(value);
+    }
+    return key;
+}
+
+} // namespace
+
+// ImageCache::Impl (PIMPL implementation)
+class ImageCache::Impl {
+public:
+    struct Entry {
+        std::string key;
+        FileTime mtime;
+        size_t bytes{0};
+        cv::Mat image;
+        std::optional<CachedTensor> tensor;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    mutable std::mutex mutex_;
+    size_t budget_{0};
+    EntryList lru_;  // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> index_;
+    ImageCacheStats stats_;
+    core::MemoryCharge charge_{core::MemoryTag::CACHE};
+
+    // Fresh entry for key, marked most recently used; stale entries are dropped
+    Entry* Find(const std::string& key, FileTime mtime) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        if (it->second->mtime != mtime) {
+            Erase(it->second);
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return &*it->second;
+    }
+
+    void Insert(Entry entry) {
+        if (entry.bytes > budget_) {
+            return;
+        }
+        auto existing = index_.find(entry.key);
+        if (existing != index_.end()) {
+            Erase(existing->second);
+        }
+
+        lru_.push_front(std::move(entry));
+        index_.emplace(lru_.front().key, lru_.begin());
+        stats_.bytes += lru_.front().bytes;
+        ++stats_.entries;
+        charge_.Allocate(lru_.front().bytes);
+        EvictToBudget();
+    }
+
+    void Erase(EntryList::iterator entry) {
+        stats_.bytes -= entry->bytes;
+        --stats_.entries;
+        charge_.Free(entry->bytes);
+        index_.erase(entry->key);
+        lru_.erase(entry);
+    }
+
+    void EvictToBudget() {
+        while (stats_.bytes > budget_ && !lru_.empty()) {
+            Erase(std::prev(lru_.end()));
+            ++stats_.evictions;
+        }
+    }
+};
+
+// ImageCache implementation
+ImageCache::ImageCache(size_t budget_bytes) : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->budget_ = budget_bytes;
+}
+
+ImageCache::~ImageCache() = default;
+
+cv::Mat ImageCache::GetImage(const std::string& path, int decode_flags) {
+    auto& impl = *pImpl_;
+    auto mtime = ModificationTime(path);
+    auto key = ImageKey(path, decode_flags);
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex_);
+        if (mtime) {
+            if (auto* entry = impl.Find(key, *mtime)) {
+                ++impl.stats_.hits;
+                return entry->image;
+            }
+        }
+        ++impl.stats_.misses;
+    }
+    if (!mtime) {
+        return cv::Mat();
+    }
+
+    cv::Mat image = cv::imread(path, decode_flags);
+    if (!image.empty()) {
+        std::lock_guard<std::mutex> lock(impl.mutex_);
+        impl.Insert({key, *mtime, MemoryUtils::GetImageMemorySize(image), image, std::nullopt});
+    }
+    return image;
+}
+
+std::optional<CachedTensor> ImageCache::GetTensor(const std::string& path, const ImageUtils::PreprocessOptions& options,
+                                                  int decode_flags) {
+    auto& impl = *pImpl_;
+    auto mtime = ModificationTime(path);
+    auto key = TensorKey(path, options, decode_flags);
+    cv::Mat image;
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex_);
+        if (mtime) {
+            if (auto* entry = impl.Find(key, *mtime)) {
+                ++impl.stats_.hits;
+                return entry->tensor;
+            }
+            if (auto* decoded = impl.Find(ImageKey(path, decode_flags), *mtime)) {
+                image = decoded->image;
+            }
+        }
+        ++impl.stats_.misses;
+    }
+    if (!mtime) {
+        return std::nullopt;
+    }
+
+    if (image.empty()) {
+        image = cv::imread(path, decode_flags);
+        if (image.empty()) {
+            return std::nullopt;
+        }
+    }
+
+    auto data = std::make_shared<std::vector<float>>(static_cast<size_t>(image.channels()) *
+                                                     static_cast<size_t>(options.target_size.area()));
+    CachedTensor tensor;
+    tensor.letterbox = ImageUtils::PreprocessToChw(image, options, std::span<float>(*data));
+    tensor.channels = image.channels();
+    tensor.original_size = image.size();
+    size_t bytes = data->size() * sizeof(float);
+    tensor.data = std::move(data);
+
+    std::lock_guard<std::mutex> lock(impl.mutex_);
+    impl.Insert({key, *mtime, bytes, cv::Mat(), tensor});
+    return tensor;
+}
+
+void ImageCache::SetBudget(size_t budget_bytes) {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    pImpl_->budget_ = budget_bytes;
+    pImpl_->EvictToBudget();
+}
+
+size_t ImageCache::GetBudget() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->budget_;
+}
+
+ImageCacheStats ImageCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->stats_;
+}
+
+void ImageCache::ResetStats() {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    pImpl_->stats_.hits = 0;
+    pImpl_->stats_.misses = 0;
+    pImpl_->stats_.evictions = 0;
+}
+
+void ImageCache::Clear() {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    pImpl_->charge_.Free(pImpl_->stats_.bytes, pImpl_->stats_.entries);
+    pImpl_->lru_.clear();
+    pImpl_->index_.clear();
+    pImpl_->stats_.entries = 0;
+    pImpl_->stats_.bytes = 0;
+}
+
+} // namespace utils
+} // namespace vision_infra
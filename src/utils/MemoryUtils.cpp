@@ -0,0 +1,274 @@
+#include "vision-infra/utils/VisionUtils.hpp"
+#include "vision-infra/core/MemoryAccounting.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace vision_infra {
+namespace utils {
+
+namespace {
+
+#ifdef __linux__
+// Reads a /proc file into buffer with plain system calls, no allocation;
+// returns the text read, empty on failure
+std::string_view ReadProcFile(const char* path, char* buffer, size_t size) {
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+    size_t length = 0;
+    while (length + 1 < size) {
+        auto count = ::read(fd, buffer + length, size - 1 - length);
+        if (count <= 0) {
+            break;
+        }
+        length += static_cast<size_t>(count);
+    }
+    ::close(fd);
+    buffer[length] = '\0';
+    return {buffer, length};
+}
+
+// Value of a "Key:   1234 kB" line in /proc/self/status, /proc/meminfo and
+// smaps_rollup, in bytes; 0 if the key is missing
+size_t ParseKbField(std::string_view text, std::string_view key) {
+    size_t pos = 0;
+    while ((pos = text.find(key, pos)) != std::string_view::npos) {
+        if (pos == 0 || text[pos - 1] == '\n') {
+            auto value = std::strtoull(text.data() + pos + key.size(), nullptr, 10);
+            return static_cast<size_t>(value) * 1024;
+        }
+        pos += key.size();
+    }
+    return 0;
+}
+
+size_t PageSize() {
+    static const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return page_size;
+}
+#endif
+
+} // namespace
+
+// MemoryUtils implementation
+size_t MemoryUtils::GetImageMemorySize(const cv::Mat& image) {
+    return image.total() * image.elemSize();
+}
+
+size_t MemoryUtils::GetTensorMemorySize(const std::vector<int64_t>& shape, size_t element_size) {
+    size_t total_elements = 1;
+    for (auto dim : shape) {
+        total_elements *= static_cast<size_t>(dim);
+    }
+    return total_elements * element_size;
+}
+
+std::string MemoryUtils::FormatBytes(size_t bytes) {
+    const char* units[] = {"B", "KB", "MB", "GB", "TB"};
+    double size = static_cast<double>(bytes);
+    int unit_index = 0;
+
+    while (size >= 1024.0 && unit_index < 4) {
+        size /= 1024.0;
+        unit_index++;
+    }
+
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.2f %s", size, units[unit_index]);
+    return std::string(buffer);
+}
+
+size_t MemoryUtils::GetSystemMemoryUsage() {
+    auto info = GetSystemMemoryInfo();
+    return info.total > info.available ? info.total - info.available : 0;
+}
+
+size_t MemoryUtils::GetProcessMemoryUsage() {
+#ifdef __linux__
+    // statm: size resident shared text lib data dt, in pages
+    char buffer[128];
+    auto text = ReadProcFile("/proc/self/statm", buffer, sizeof(buffer));
+    if (text.empty()) {
+        return 0;
+    }
+    char* end = nullptr;
+    std::strtoull(text.data(), &end, 10);
+    return static_cast<size_t>(std::strtoull(end, nullptr, 10)) * PageSize();
+#else
+    return 0;
+#endif
+}
+
+MemoryUtils::ProcessMemoryInfo MemoryUtils::GetProcessMemoryInfo(bool detailed) {
+    ProcessMemoryInfo info;
+#ifdef __linux__
+    char buffer[4096];
+    auto status = ReadProcFile("/proc/self/status", buffer, sizeof(buffer));
+    info.rss = ParseKbField(status, "VmRSS:");
+    info.peak_rss = ParseKbField(status, "VmHWM:");
+    info.virtual_size = ParseKbField(status, "VmSize:");
+    info.swap = ParseKbField(status, "VmSwap:");
+    if (detailed) {
+        info.pss = ParseKbField(ReadProcFile("/proc/self/smaps_rollup", buffer, sizeof(buffer)), "Pss:");
+    }
+#else
+    (void)detailed;
+#endif
+    return info;
+}
+
+MemoryUtils::SystemMemoryInfo MemoryUtils::GetSystemMemoryInfo() {
+    SystemMemoryInfo info;
+#ifdef __linux__
+    char buffer[4096];
+    auto meminfo = ReadProcFile("/proc/meminfo", buffer, sizeof(buffer));
+    info.total = ParseKbField(meminfo, "MemTotal:");
+    info.free = ParseKbField(meminfo, "MemFree:");
+    info.available = ParseKbField(meminfo, "MemAvailable:");
+#endif
+    return info;
+}
+
+std::string MemoryUtils::FormatAccountingReport() {
+    if (!core::MemoryAccounting::IsEnabled()) {
+        return {};
+    }
+    std::string report;
+    auto stats = core::MemoryAccounting::GetAllStats();
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const auto& tag = stats[i];
+        report += core::MemoryAccounting::GetTagName(static_cast<core::MemoryTag>(i));
+        report += ": live " + FormatBytes(tag.live_bytes) + ", peak " + FormatBytes(tag.peak_bytes) +
+                  ", allocations " + std::to_string(tag.allocations) + ", frees " + std::to_string(tag.frees) + "\n";
+    }
+    return report;
+}
+
+// MemoryUtils::Sampler::Impl (PIMPL implementation)
+class MemoryUtils::Sampler::Impl {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    std::chrono::milliseconds interval_;
+    std::chrono::milliseconds window_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable stop_cv_;
+    std::thread thread_;
+    bool running_{false};
+
+    size_t current_{0};
+    size_t peak_{0};
+    size_t samples_{0};
+    // Samples that can still become the window maximum: RSS strictly decreasing from front to back
+    std::deque<std::pair<Clock::time_point, size_t>> window_max_;
+
+    void Record(size_t rss) {
+        auto now = Clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        current_ = rss;
+        peak_ = std::max(peak_, rss);
+        ++samples_;
+        while (!window_max_.empty() && window_max_.back().second <= rss) {
+            window_max_.pop_back();
+        }
+        window_max_.emplace_back(now, rss);
+        ExpireWindow(now);
+    }
+
+    void ExpireWindow(Clock::time_point now) {
+        while (window_max_.size() > 1 && now - window_max_.front().first > window_) {
+            window_max_.pop_front();
+        }
+    }
+
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_) {
+            lock.unlock();
+            Record(MemoryUtils::GetProcessMemoryUsage());
+            lock.lock();
+            stop_cv_.wait_for(lock, interval_, [this] { return !running_; });
+        }
+    }
+};
+
+// MemoryUtils::Sampler implementation
+MemoryUtils::Sampler::Sampler(std::chrono::milliseconds interval, std::chrono::milliseconds window)
+    : pImpl_(std::make_unique<Impl>()) {
+    pImpl_->interval_ = std::max(interval, std::chrono::milliseconds(1));
+    pImpl_->window_ = window;
+}
+
+MemoryUtils::Sampler::~Sampler() {
+    Stop();
+}
+
+void MemoryUtils::Sampler::Start() {
+    Stop();
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+        pImpl_->running_ = true;
+        pImpl_->current_ = 0;
+        pImpl_->peak_ = 0;
+        pImpl_->samples_ = 0;
+        pImpl_->window_max_.clear();
+    }
+    // Take the first sample synchronously so the readings are valid on return
+    pImpl_->Record(GetProcessMemoryUsage());
+    pImpl_->thread_ = std::thread([impl = pImpl_.get()] { impl->Run(); });
+}
+
+void MemoryUtils::Sampler::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+        pImpl_->running_ = false;
+    }
+    pImpl_->stop_cv_.notify_all();
+    if (pImpl_->thread_.joinable()) {
+        pImpl_->thread_.join();
+    }
+}
+
+bool MemoryUtils::Sampler::IsRunning() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->running_;
+}
+
+size_t MemoryUtils::Sampler::GetCurrentRss() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->current_;
+}
+
+size_t MemoryUtils::Sampler::GetWindowPeakRss() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    pImpl_->ExpireWindow(Impl::Clock::now());
+    return pImpl_->window_max_.empty() ? 0 : pImpl_->window_max_.front().second;
+}
+
+size_t MemoryUtils::Sampler::GetPeakRss() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->peak_;
+}
+
+size_t MemoryUtils::Sampler::GetSampleCount() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->samples_;
+}
+
+} // namespace utils
+} // namespace vision_infra
@@ -0,0 +1,249 @@
+#include "vision-infra/utils/TensorBufferPool.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace vision_infra {
+namespace utils {
+
+namespace {
+
+constexpr size_t kMinSizeClass = 256;
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+constexpr size_t kSizeClasses = std::numeric_limits<size_t>::digits;
+
+size_t SizeClassIndex(size_t capacity) {
+    return static_cast<size_t>(std::countr_zero(capacity));
+}
+
+} // namespace
+
+// TensorBuffer implementation
+TensorBuffer::~TensorBuffer() {
+    Release();
+}
+
+TensorBuffer::TensorBuffer(TensorBuffer&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)) {}
+
+TensorBuffer& TensorBuffer::operator=(TensorBuffer&& other) noexcept {
+    if (this != &other) {
+        Release();
+        pool_ = std::exchange(other.pool_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+}
+
+void TensorBuffer::Release() noexcept {
+    if (data_) {
+        pool_->Release(data_, capacity_);
+    }
+    pool_ = nullptr;
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+}
+
+cv::Mat TensorBuffer::AsMat(int rows, int cols, int type) const {
+    return AsMat(std::vector<int>{rows, cols}, type);
+}
+
+cv::Mat TensorBuffer::AsMat(const std::vector<int>& sizes, int type) const {
+    size_t bytes = static_cast<size_t>(CV_ELEM_SIZE(type));
+    for (int size : sizes) {
+        if (size < 0) {
+            throw std::invalid_argument("Negative dimension in TensorBuffer::AsMat");
+        }
+        bytes *= static_cast<size_t>(size);
+    }
+    if (sizes.empty() || bytes > capacity_) {
+        throw std::invalid_argument("Shape does not fit in the tensor buffer");
+    }
+    return cv::Mat(static_cast<int>(sizes.size()), sizes.data(), type, data_);
+}
+
+// TensorBufferPool::Impl (PIMPL implementation)
+class TensorBufferPool::Impl {
+public:
+    TensorBufferPoolOptions options_;
+
+    mutable std::mutex mutex_;
+    std::array<std::vector<void*>, kSizeClasses> idle_;  // Per size class, most recently released last
+    TensorBufferPoolStats stats_;
+    core::MemoryCharge charge_;  // Buffers in use and cached
+
+    bool UsesHugePages(size_t capacity) const {
+#ifdef __linux__
+        return options_.use_huge_pages && capacity >= kHugePageSize;
+#else
+        (void)capacity;
+        return false;
+#endif
+    }
+
+    void* Allocate(size_t capacity) const {
+#ifdef __linux__
+        if (UsesHugePages(capacity)) {
+            // Over-map and trim so the buffer starts on a huge page boundary
+            // (or options_.alignment, if larger); THP only covers whole,
+            // aligned 2 MiB ranges
+            const size_t alignment = std::max(options_.alignment, kHugePageSize);
+            if (capacity > std::numeric_limits<size_t>::max() - alignment) {
+                throw std::bad_alloc();
+            }
+            const size_t mapped = capacity + alignment;
+            void* raw = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            auto* base = static_cast<std::byte*>(raw);
+            const auto address = reinterpret_cast<uintptr_t>(raw);
+            const size_t head = ((address + alignment - 1) & ~(uintptr_t{alignment} - 1)) - address;
+            if (head > 0) {
+                ::munmap(base, head);
+            }
+            ::munmap(base + head + capacity, mapped - head - capacity);
+            void* data = base + head;
+            // Best effort: falls back to normal pages if THP is disabled
+            ::madvise(data, capacity, MADV_HUGEPAGE);
+            return data;
+        }
+#endif
+        return ::operator new(capacity, std::align_val_t(options_.alignment));
+    }
+
+    void Free(void* data, size_t capacity) const noexcept {
+#ifdef __linux__
+        if (UsesHugePages(capacity)) {
+            ::munmap(data, capacity);
+            return;
+        }
+#endif
+        ::operator delete(data, capacity, std::align_val_t(options_.alignment));
+    }
+};
+
+// TensorBufferPool implementation
+TensorBufferPool::TensorBufferPool(const TensorBufferPoolOptions& options) : pImpl_(std::make_unique<Impl>()) {
+    if (!std::has_single_bit(options.alignment) || options.alignment < alignof(std::max_align_t)) {
+        throw std::invalid_argument("Tensor buffer alignment must be a power of two of at least " +
+                                    std::to_string(alignof(std::max_align_t)));
+    }
+    pImpl_->options_ = options;
+    pImpl_->charge_ = core::MemoryCharge(options.tag);
+}
+
+TensorBufferPool::~TensorBufferPool() {
+    Trim();
+}
+
+size_t TensorBufferPool::GetSizeClass(size_t bytes) {
+    if (bytes > (std::numeric_limits<size_t>::max() >> 1) + 1) {
+        throw std::bad_alloc();
+    }
+    return std::max(kMinSizeClass, std::bit_ceil(bytes));
+}
+
+TensorBuffer TensorBufferPool::Acquire(size_t bytes) {
+    if (bytes == 0) {
+        return TensorBuffer();
+    }
+    auto& impl = *pImpl_;
+    size_t capacity = GetSizeClass(bytes);
+    auto& idle = impl.idle_[SizeClassIndex(capacity)];
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex_);
+        ++impl.stats_.acquires;
+        if (!idle.empty()) {
+            void* data = idle.back();
+            idle.pop_back();
+            ++impl.stats_.reuses;
+            impl.stats_.bytes_cached -= capacity;
+            impl.stats_.bytes_in_use += capacity;
+            return TensorBuffer(this, data, bytes, capacity);
+        }
+    }
+
+    void* data = impl.Allocate(capacity);
+    std::lock_guard<std::mutex> lock(impl.mutex_);
+    ++impl.stats_.allocations;
+    impl.stats_.bytes_in_use += capacity;
+    impl.charge_.Allocate(capacity);
+    return TensorBuffer(this, data, bytes, capacity);
+}
+
+TensorBuffer TensorBufferPool::Acquire(const std::vector<int64_t>& shape, size_t element_size) {
+    return Acquire(MemoryUtils::GetTensorMemorySize(shape, element_size));
+}
+
+void TensorBufferPool::Release(void* data, size_t capacity) noexcept {
+    auto& impl = *pImpl_;
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex_);
+        impl.stats_.bytes_in_use -= capacity;
+        if (impl.stats_.bytes_cached + capacity <= impl.options_.max_cached_bytes) {
+            try {
+                impl.idle_[SizeClassIndex(capacity)].push_back(data);
+                impl.stats_.bytes_cached += capacity;
+                return;
+            } catch (const std::bad_alloc&) {
+                // Free it instead
+            }
+        }
+        impl.charge_.Free(capacity);
+    }
+    impl.Free(data, capacity);
+}
+
+void TensorBufferPool::Trim() {
+    auto& impl = *pImpl_;
+    std::array<std::vector<void*>, kSizeClasses> idle;
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex_);
+        idle.swap(impl.idle_);
+        size_t buffers = 0;
+        for (const auto& buffers_of_class : idle) {
+            buffers += buffers_of_class.size();
+        }
+        impl.charge_.Free(impl.stats_.bytes_cached, buffers);
+        impl.stats_.bytes_cached = 0;
+    }
+    for (size_t index = 0; index < idle.size(); ++index) {
+        for (void* data : idle[index]) {
+            impl.Free(data, size_t{1} << index);
+        }
+    }
+}
+
+TensorBufferPoolStats TensorBufferPool::GetStats() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    return pImpl_->stats_;
+}
+
+void TensorBufferPool::ResetStats() {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex_);
+    pImpl_->stats_.acquires = 0;
+    pImpl_->stats_.reuses = 0;
+    pImpl_->stats_.allocations = 0;
+}
+
+} // namespace utils
+} // namespace vision_infra
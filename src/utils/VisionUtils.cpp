@@ -1,10 +1,16 @@
 #include "vision-infra/utils/VisionUtils.hpp"
+#include "vision-infra/core/Profiler.hpp"
 #include <algorithm>
 #include <random>
 #include <sstream>
 #include <set>
 #include <chrono>
 #include <filesystem>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
 
 namespace vision_infra {
 namespace utils {
@@ -150,6 +156,7 @@ std::vector<cv::Scalar> DrawingUtils::GenerateRandomColors(size_t count, unsigne
 
 void DrawingUtils::DrawLabel(cv::Mat& image, const std::string& label, float confidence, 
                             int x, int y, const cv::Scalar& /* color */, int font, double font_scale, int thickness) {
+    PROFILE_ZONE("draw.label");
     std::string confidenceStr = std::to_string(confidence).substr(0, 4);
     std::string display_text = label + ": " + confidenceStr;
     
@@ -167,16 +174,19 @@ void DrawingUtils::DrawLabel(cv::Mat& image, const std::string& label, float con
 
 void DrawingUtils::DrawBoundingBox(cv::Mat& image, int x, int y, int width, int height,
                                   const cv::Scalar& color, int thickness) {
+    PROFILE_ZONE("draw.box");
     cv::rectangle(image, cv::Point(x, y), cv::Point(x + width, y + height), color, thickness);
 }
 
 void DrawingUtils::DrawBoundingBox(cv::Mat& image, const cv::Rect& rect,
                                   const cv::Scalar& color, int thickness) {
+    PROFILE_ZONE("draw.box");
     cv::rectangle(image, rect, color, thickness);
 }
 
 void DrawingUtils::DrawPolygon(cv::Mat& image, const std::vector<cv::Point>& points,
                               const cv::Scalar& color, int thickness) {
+    PROFILE_ZONE("draw.polygon");
     if (points.size() < 2) return;
     
     for (size_t i = 0; i < points.size(); ++i) {
@@ -188,6 +198,7 @@ void DrawingUtils::DrawPolygon(cv::Mat& image, const std::vector<cv::Point>& poi
 
 void DrawingUtils::DrawFilledPolygon(cv::Mat& image, const std::vector<cv::Point>& points,
                                     const cv::Scalar& color) {
+    PROFILE_ZONE("draw.polygon");
     if (points.size() < 3) return;
     
     std::vector<cv::Point> pts = points;
@@ -196,6 +207,7 @@ void DrawingUtils::DrawFilledPolygon(cv::Mat& image, const std::vector<cv::Point
 
 void DrawingUtils::DrawKeypoints(cv::Mat& image, const std::vector<cv::Point2f>& keypoints,
                                 const cv::Scalar& color, int radius) {
+    PROFILE_ZONE("draw.keypoints");
     for (const auto& point : keypoints) {
         cv::circle(image, cv::Point(static_cast<int>(point.x), static_cast<int>(point.y)), 
                   radius, color, -1);
@@ -207,27 +219,352 @@ cv::Size DrawingUtils::GetTextSize(const std::string& text, int font, double fon
     return cv::getTextSize(text, font, font_scale, thickness, &baseline);
 }
 
+// Fused preprocessing kernel
+namespace {
+
+constexpr int kMaxPreprocessChannels = 4;
+
+// Per-channel affine transform applied to every pixel: value * alpha + beta,
+// plus the destination plane for each source channel.
+struct ChannelTransform {
+    std::array<float, kMaxPreprocessChannels> alpha{};
+    std::array<float, kMaxPreprocessChannels> beta{};
+    std::array<float, kMaxPreprocessChannels> fill{};
+    std::array<int, kMaxPreprocessChannels> plane{};
+};
+
+// Preprocessing errors name the public entry point that was called
+[[noreturn]] void ThrowPreprocessError(std::string_view caller, std::string_view problem) {
+    throw std::invalid_argument(std::string(caller) + ": " + std::string(problem));
+}
+
+ChannelTransform MakeChannelTransform(int channels, const ImageUtils::PreprocessOptions& options,
+                                      bool normalize, std::string_view caller) {
+    ChannelTransform transform;
+    for (int c = 0; c < channels; ++c) {
+        const auto index = static_cast<size_t>(c);
+        const int plane = (options.swap_rb && channels >= 3 && c != 1 && c < 3) ? 2 - c : c;
+        // mean/std follow the output planes, i.e. the order after swap_rb
+        const auto plane_index = static_cast<size_t>(plane);
+        float mean = normalize && plane_index < options.mean.size() ? options.mean[plane_index] : 0.0f;
+        float stddev = normalize && plane_index < options.std.size() ? options.std[plane_index] : 1.0f;
+        if (stddev == 0.0f) {
+            ThrowPreprocessError(caller, "std must be non-zero");
+        }
+        transform.alpha[index] = (normalize ? options.scale : 1.0f) / stddev;
+        transform.beta[index] = -mean / stddev;
+        transform.fill[index] = static_cast<float>(options.fill_color[c]) * transform.alpha[index] +
+                                transform.beta[index];
+        transform.plane[index] = plane;
+    }
+    return transform;
+}
+
+// Bilinear source taps for one output coordinate, using the same half-pixel
+// mapping as cv::resize with INTER_LINEAR.
+struct LinearTap {
+    int first;
+    int second;
+    float weight;
+};
+
+void ComputeLinearTaps(int src_length, int dst_length, int stride, std::vector<LinearTap>& taps) {
+    taps.resize(static_cast<size_t>(dst_length));
+    const double ratio = static_cast<double>(src_length) / dst_length;
+    for (int i = 0; i < dst_length; ++i) {
+        double position = (i + 0.5) * ratio - 0.5;
+        int first = static_cast<int>(std::floor(position));
+        float weight = static_cast<float>(position - first);
+        if (first < 0) {
+            first = 0;
+            weight = 0.0f;
+        }
+        if (first >= src_length - 1) {
+            first = src_length - 1;
+            weight = 0.0f;
+        }
+        int second = std::min(first + 1, src_length - 1);
+        taps[static_cast<size_t>(i)] = {first * stride, second * stride, weight};
+    }
+}
+
+template<typename T>
+T StoreValue(float value) {
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        return static_cast<uint8_t>(std::clamp(value + 0.5f, 0.0f, 255.0f));
+    } else {
+        return value;
+    }
+}
+
+// Writes output rows [row_begin, row_end) of a letterboxed, normalized CHW tensor.
+template<size_t Channels, typename T>
+void LetterboxRowsToChw(const cv::Mat& image, const ImageUtils::LetterboxInfo& info,
+                        const cv::Size& target_size, const ChannelTransform& transform,
+                        T* output, int row_begin, int row_end) {
+    thread_local std::vector<LinearTap> x_taps;
+    ComputeLinearTaps(image.cols, info.resized_size.width, static_cast<int>(Channels), x_taps);
+
+    const size_t plane_size = static_cast<size_t>(target_size.width) * static_cast<size_t>(target_size.height);
+    const double y_ratio = static_cast<double>(image.rows) / info.resized_size.height;
+    std::array<T*, Channels> planes{};
+    std::array<T, Channels> fill{};
+    for (size_t c = 0; c < Channels; ++c) {
+        planes[c] = output + static_cast<size_t>(transform.plane[c]) * plane_size;
+        fill[c] = StoreValue<T>(transform.fill[c]);
+    }
+
+    for (int y = row_begin; y < row_end; ++y) {
+        const size_t row_offset = static_cast<size_t>(y) * static_cast<size_t>(target_size.width);
+        const int dy = y - info.pad_y;
+
+        if (dy < 0 || dy >= info.resized_size.height) {
+            for (size_t c = 0; c < Channels; ++c) {
+                std::fill_n(planes[c] + row_offset, target_size.width, fill[c]);
+            }
+            continue;
+        }
+
+        for (size_t c = 0; c < Channels; ++c) {
+            T* row = planes[c] + row_offset;
+            std::fill_n(row, info.pad_x, fill[c]);
+            std::fill(row + info.pad_x + info.resized_size.width, row + target_size.width, fill[c]);
+        }
+
+        double position = (dy + 0.5) * y_ratio - 0.5;
+        int y0 = static_cast<int>(std::floor(position));
+        float wy = static_cast<float>(position - y0);
+        if (y0 < 0) {
+            y0 = 0;
+            wy = 0.0f;
+        }
+        if (y0 >= image.rows - 1) {
+            y0 = image.rows - 1;
+            wy = 0.0f;
+        }
+        const int y1 = std::min(y0 + 1, image.rows - 1);
+        const uchar* top = image.ptr<uchar>(y0);
+        const uchar* bottom = image.ptr<uchar>(y1);
+
+        const size_t out_begin = row_offset + static_cast<size_t>(info.pad_x);
+        for (size_t x = 0; x < x_taps.size(); ++x) {
+            const LinearTap& tap = x_taps[x];
+            for (size_t c = 0; c < Channels; ++c) {
+                const auto first = static_cast<size_t>(tap.first) + c;
+                const auto second = static_cast<size_t>(tap.second) + c;
+                float upper = static_cast<float>(top[first]) +
+                              tap.weight * static_cast<float>(top[second] - top[first]);
+                float lower = static_cast<float>(bottom[first]) +
+                              tap.weight * static_cast<float>(bottom[second] - bottom[first]);
+                float value = upper + wy * (lower - upper);
+                planes[c][out_begin + x] = StoreValue<T>(value * transform.alpha[c] + transform.beta[c]);
+            }
+        }
+    }
+}
+
+template<typename T>
+void LetterboxRowsToChw(const cv::Mat& image, const ImageUtils::LetterboxInfo& info,
+                        const cv::Size& target_size, const ChannelTransform& transform,
+                        T* output, int row_begin, int row_end) {
+    switch (image.channels()) {
+        case 1: LetterboxRowsToChw<1>(image, info, target_size, transform, output, row_begin, row_end); break;
+        case 2: LetterboxRowsToChw<2>(image, info, target_size, transform, output, row_begin, row_end); break;
+        case 3: LetterboxRowsToChw<3>(image, info, target_size, transform, output, row_begin, row_end); break;
+        case 4: LetterboxRowsToChw<4>(image, info, target_size, transform, output, row_begin, row_end); break;
+        default: throw std::invalid_argument("PreprocessToChw: unsupported channel count");
+    }
+}
+
+void ValidatePreprocessInput(const cv::Mat& image, const cv::Size& target_size, std::string_view caller) {
+    if (image.empty()) {
+        ThrowPreprocessError(caller, "input image is empty");
+    }
+    if (image.depth() != CV_8U) {
+        ThrowPreprocessError(caller, "input image must be 8-bit");
+    }
+    if (image.channels() < 1 || image.channels() > kMaxPreprocessChannels) {
+        ThrowPreprocessError(caller, "input image must have 1-4 channels");
+    }
+    if (target_size.width <= 0 || target_size.height <= 0) {
+        ThrowPreprocessError(caller, "target size must be positive");
+    }
+}
+
+// Rows per band when splitting a single image across workers
+constexpr int kMinRowsPerBand = 16;
+
+struct RowBand {
+    size_t image;
+    int row_begin;
+    int row_end;
+};
+
+// Preprocess images into consecutive slots of output, optionally spreading
+// whole images and row bands across a thread pool. caller prefixes errors.
+template<typename T>
+std::vector<ImageUtils::LetterboxInfo> PreprocessInto(std::span<const cv::Mat> images,
+                                                      const ImageUtils::PreprocessOptions& options,
+                                                      std::span<T> output, core::ThreadPool* pool,
+                                                      std::string_view caller) {
+    PROFILE_ZONE("preprocess.letterbox_chw");
+    std::vector<ImageUtils::LetterboxInfo> infos;
+    if (images.empty()) {
+        return infos;
+    }
+
+    const int channels = images.front().channels();
+    for (const auto& image : images) {
+        ValidatePreprocessInput(image, options.target_size, caller);
+        if (image.channels() != channels) {
+            ThrowPreprocessError(caller, "all images must have the same channel count");
+        }
+    }
+
+    const size_t image_size = static_cast<size_t>(channels) * static_cast<size_t>(options.target_size.area());
+    if (output.size() / image_size < images.size()) {
+        ThrowPreprocessError(caller, "output buffer is too small");
+    }
+
+    const auto transform = MakeChannelTransform(channels, options, std::is_same_v<T, float>, caller);
+    const int rows = options.target_size.height;
+    infos.reserve(images.size());
+    for (const auto& image : images) {
+        infos.push_back(ImageUtils::ComputeLetterbox(image.size(), options.target_size));
+    }
+
+    if (pool == nullptr || pool->GetNumThreads() <= 1) {
+        for (size_t i = 0; i < images.size(); ++i) {
+            LetterboxRowsToChw(images[i], infos[i], options.target_size, transform,
+                               output.data() + i * image_size, 0, rows);
+        }
+        return infos;
+    }
+
+    const size_t workers = pool->GetNumThreads() + 1;
+    const size_t bands_per_image = std::clamp<size_t>((workers + images.size() - 1) / images.size(), 1,
+                                                      static_cast<size_t>(std::max(1, rows / kMinRowsPerBand)));
+    const int band_rows = static_cast<int>((static_cast<size_t>(rows) + bands_per_image - 1) / bands_per_image);
+
+    std::vector<RowBand> bands;
+    bands.reserve(images.size() * bands_per_image);
+    for (size_t i = 0; i < images.size(); ++i) {
+        for (int row = 0; row < rows; row += band_rows) {
+            bands.push_back({i, row, std::min(rows, row + band_rows)});
+        }
+    }
+
+    pool->ParallelFor(0, bands.size(), [&](size_t b) {
+        const RowBand& band = bands[b];
+        LetterboxRowsToChw(images[band.image], infos[band.image], options.target_size, transform,
+                           output.data() + band.image * image_size, band.row_begin, band.row_end);
+    });
+    return infos;
+}
+
+template<typename T>
+ImageUtils::LetterboxInfo PreprocessImage(const cv::Mat& image, const ImageUtils::PreprocessOptions& options,
+                                          std::span<T> output, core::ThreadPool* pool) {
+    return PreprocessInto(std::span<const cv::Mat>(&image, 1), options, output, pool, "PreprocessToChw").front();
+}
+
+template<typename T>
+std::vector<ImageUtils::LetterboxInfo> PreprocessBatch(const std::vector<cv::Mat>& images,
+                                                       const ImageUtils::PreprocessOptions& options,
+                                                       std::span<T> output, core::ThreadPool* pool) {
+    auto infos = PreprocessInto(std::span<const cv::Mat>(images), options, output, pool, "BatchImages");
+
+    // Zero the batch slots that were not filled
+    size_t used = 0;
+    size_t capacity = output.size();
+    if (!images.empty()) {
+        const size_t image_size = static_cast<size_t>(images.front().channels()) *
+                                  static_cast<size_t>(options.target_size.area());
+        used = images.size() * image_size;
+        capacity = output.size() / image_size * image_size;
+    }
+    std::fill(output.begin() + static_cast<std::ptrdiff_t>(used),
+              output.begin() + static_cast<std::ptrdiff_t>(capacity), T{});
+    return infos;
+}
+
+} // namespace
+
 // ImageUtils implementation
+ImageUtils::LetterboxInfo ImageUtils::ComputeLetterbox(const cv::Size& image_size, const cv::Size& target_size) {
+    double scale = std::min(static_cast<double>(target_size.width) / image_size.width,
+                           static_cast<double>(target_size.height) / image_size.height);
+
+    LetterboxInfo info;
+    info.scale = static_cast<float>(scale);
+    info.resized_size = cv::Size(std::max(1, static_cast<int>(image_size.width * scale)),
+                                 std::max(1, static_cast<int>(image_size.height * scale)));
+    info.pad_x = (target_size.width - info.resized_size.width) / 2;
+    info.pad_y = (target_size.height - info.resized_size.height) / 2;
+    return info;
+}
+
+ImageUtils::LetterboxInfo ImageUtils::PreprocessToChw(const cv::Mat& image, const PreprocessOptions& options,
+                                                      std::span<float> output) {
+    return PreprocessImage(image, options, output, nullptr);
+}
+
+ImageUtils::LetterboxInfo ImageUtils::PreprocessToChw(const cv::Mat& image, const PreprocessOptions& options,
+                                                      std::span<uint8_t> output) {
+    return PreprocessImage(image, options, output, nullptr);
+}
+
+ImageUtils::LetterboxInfo ImageUtils::PreprocessToChw(const cv::Mat& image, const PreprocessOptions& options,
+                                                      std::span<float> output, core::ThreadPool& pool) {
+    return PreprocessImage(image, options, output, &pool);
+}
+
+std::vector<ImageUtils::LetterboxInfo> ImageUtils::BatchImages(const std::vector<cv::Mat>& images,
+                                                               const PreprocessOptions& options,
+                                                               std::span<float> output) {
+    return PreprocessBatch(images, options, output, nullptr);
+}
+
+std::vector<ImageUtils::LetterboxInfo> ImageUtils::BatchImages(const std::vector<cv::Mat>& images,
+                                                               const PreprocessOptions& options,
+                                                               std::span<uint8_t> output) {
+    return PreprocessBatch(images, options, output, nullptr);
+}
+
+std::vector<ImageUtils::LetterboxInfo> ImageUtils::BatchImages(const std::vector<cv::Mat>& images,
+                                                               const PreprocessOptions& options,
+                                                               std::span<float> output, core::ThreadPool& pool) {
+    return PreprocessBatch(images, options, output, &pool);
+}
+
+std::vector<ImageUtils::LetterboxInfo> ImageUtils::BatchImages(const std::vector<cv::Mat>& images,
+                                                               const PreprocessOptions& options,
+                                                               std::span<uint8_t> output, core::ThreadPool& pool) {
+    return PreprocessBatch(images, options, output, &pool);
+}
+
+std::vector<int64_t> ImageUtils::GetBatchShape(size_t batch_size, int channels, const cv::Size& target_size) {
+    return {static_cast<int64_t>(batch_size), channels, target_size.height, target_size.width};
+}
+
 cv::Mat ImageUtils::ResizeKeepAspectRatio(const cv::Mat& image, const cv::Size& target_size,
                                          const cv::Scalar& fill_color) {
-    double scale = std::min(static_cast<double>(target_size.width) / image.cols,
-                           static_cast<double>(target_size.height) / image.rows);
-    
-    cv::Size new_size(static_cast<int>(image.cols * scale), 
-                      static_cast<int>(image.rows * scale));
-    
-    cv::Mat resized;
-    cv::resize(image, resized, new_size);
-    
-    cv::Mat result(target_size, image.type(), fill_color);
-    
-    int x_offset = (target_size.width - new_size.width) / 2;
-    int y_offset = (target_size.height - new_size.height) / 2;
+    cv::Mat result;
+    ResizeKeepAspectRatio(image, target_size, result, fill_color);
+    return result;
+}
+
+void ImageUtils::ResizeKeepAspectRatio(const cv::Mat& image, const cv::Size& target_size, cv::Mat& output,
+                                       const cv::Scalar& fill_color) {
+    PROFILE_ZONE("preprocess.resize");
+    LetterboxInfo info = ComputeLetterbox(image.size(), target_size);
     
-    cv::Rect roi(x_offset, y_offset, new_size.width, new_size.height);
-    resized.copyTo(result(roi));
+    output.create(target_size, image.type());
+    output.setTo(fill_color);
     
-    return result;
+    // Resize straight into the letterbox region; the ROI already has the right size, so nothing is allocated
+    cv::Mat roi = output(cv::Rect(info.pad_x, info.pad_y, info.resized_size.width, info.resized_size.height));
+    cv::resize(image, roi, info.resized_size);
 }
 
 cv::Mat ImageUtils::CenterCrop(const cv::Mat& image, const cv::Size& crop_size) {
@@ -241,45 +578,74 @@ cv::Mat ImageUtils::CenterCrop(const cv::Mat& image, const cv::Size& crop_size)
 cv::Mat ImageUtils::Normalize(const cv::Mat& image, const std::vector<float>& mean,
                              const std::vector<float>& std) {
     cv::Mat normalized;
-    image.convertTo(normalized, CV_32F, 1.0 / 255.0);
-    
-    std::vector<cv::Mat> channels;
-    cv::split(normalized, channels);
+    Normalize(image, mean, std, normalized);
+    return normalized;
+}
+
+void ImageUtils::Normalize(const cv::Mat& image, const std::vector<float>& mean,
+                           const std::vector<float>& std, cv::Mat& output) {
+    PROFILE_ZONE("preprocess.normalize");
+    image.convertTo(output, CV_32F, 1.0 / 255.0);
     
-    for (size_t i = 0; i < channels.size() && i < mean.size() && i < std.size(); ++i) {
-        channels[i] = (channels[i] - mean[i]) / std[i];
+    // Channels without a mean/std entry are left as scaled
+    const auto channels = static_cast<size_t>(output.channels());
+    const size_t normalized = std::min({channels, mean.size(), std.size()});
+    if (normalized == 0) {
+        return;
+    }
+    for (int y = 0; y < output.rows; ++y) {
+        float* pixel = output.ptr<float>(y);
+        for (int x = 0; x < output.cols; ++x, pixel += channels) {
+            for (size_t c = 0; c < normalized; ++c) {
+                pixel[c] = (pixel[c] - mean[c]) / std[c];
+            }
+        }
     }
-    
-    cv::merge(channels, normalized);
-    return normalized;
 }
 
 cv::Mat ImageUtils::HwcToChw(const cv::Mat& image) {
-    // OpenCV stores images as HWC, this converts to CHW for some frameworks
-    std::vector<cv::Mat> channels;
-    cv::split(image, channels);
-    
     cv::Mat result;
-    cv::merge(channels, result);
-    
-    // Reshape to CHW format
-    int dims[] = {static_cast<int>(channels.size()), image.rows, image.cols};
-    result = result.reshape(1, 3, dims);
-    
+    HwcToChw(image, result);
     return result;
 }
 
-cv::Mat ImageUtils::ChwToHwc(const cv::Mat& image) {
-    // Convert CHW back to HWC format
-    std::vector<cv::Mat> channels;
-    cv::split(image, channels);
+void ImageUtils::HwcToChw(const cv::Mat& image, cv::Mat& output) {
+    PROFILE_ZONE("preprocess.hwc_to_chw");
+    // OpenCV stores images as HWC, this converts to planar CHW for some frameworks
+    const int channels = image.channels();
+    const int dims[] = {channels, image.rows, image.cols};
+    output.create(3, dims, image.depth());
     
+    for (int c = 0; c < channels; ++c) {
+        cv::Mat plane(image.rows, image.cols, image.depth(), output.ptr(c), output.step[1]);
+        cv::extractChannel(image, plane, c);
+    }
+}
+
+cv::Mat ImageUtils::ChwToHwc(const cv::Mat& image) {
     cv::Mat result;
-    cv::merge(channels, result);
-    
+    ChwToHwc(image, result);
     return result;
 }
 
+void ImageUtils::ChwToHwc(const cv::Mat& image, cv::Mat& output) {
+    // Convert CHW back to HWC format; 2-dimensional images are already HWC
+    if (image.dims != 3) {
+        image.copyTo(output);
+        return;
+    }
+    
+    const int channels = image.size[0];
+    const int rows = image.size[1];
+    const int cols = image.size[2];
+    output.create(rows, cols, CV_MAKETYPE(image.depth(), channels));
+    
+    for (int c = 0; c < channels; ++c) {
+        cv::Mat plane(rows, cols, image.depth(), const_cast<uchar*>(image.ptr(c)), image.step[1]);
+        cv::insertChannel(plane, output, c);
+    }
+}
+
 // PerformanceUtils::Timer implementation
 PerformanceUtils::Timer::Timer() {
     Reset();
@@ -314,78 +680,107 @@ double PerformanceUtils::Timer::GetElapsedSeconds() const {
 }
 
 // PerformanceUtils::FPSCounter implementation
-PerformanceUtils::FPSCounter::FPSCounter(size_t window_size) 
-    : timestamps_(window_size), window_size_(window_size) {}
+namespace {
+
+double IntervalMs(PerformanceUtils::FPSCounter::Clock::duration interval) {
+    return std::chrono::duration<double, std::milli>(interval).count();
+}
+
+} // namespace
+
+PerformanceUtils::FPSCounter::FPSCounter(size_t window_size, double deadline_ms)
+    : timestamps_(window_size), window_size_(window_size), deadline_ms_(deadline_ms) {
+    if (window_size < 2) {
+        throw std::invalid_argument("FPSCounter window must hold at least 2 frames");
+    }
+}
 
 void PerformanceUtils::FPSCounter::Update() {
-    timestamps_[current_index_] = std::chrono::high_resolution_clock::now();
+    Update(Clock::now());
+}
+
+void PerformanceUtils::FPSCounter::Update(Clock::time_point timestamp) {
+    if (frame_count_ == 0) {
+        first_timestamp_ = timestamp;
+    } else {
+        double interval = IntervalMs(timestamp - last_timestamp_);
+        interval_sum_ms_ += interval;
+        interval_sq_sum_ms_ += interval * interval;
+        if (deadline_ms_ > 0.0 && interval > deadline_ms_) {
+            ++deadline_misses_;
+        }
+    }
+
+    if (window_frames_ == window_size_) {
+        // The oldest frame and its interval to the next leave the window
+        double leaving = IntervalMs(timestamps_[(current_index_ + 1) % window_size_] - timestamps_[current_index_]);
+        interval_sum_ms_ -= leaving;
+        interval_sq_sum_ms_ -= leaving * leaving;
+    } else {
+        ++window_frames_;
+    }
+
+    timestamps_[current_index_] = timestamp;
     current_index_ = (current_index_ + 1) % window_size_;
-    
-    if (!buffer_full_ && current_index_ == 0) {
-        buffer_full_ = true;
+    last_timestamp_ = timestamp;
+    ++frame_count_;
+
+    // Recompute the running sums once per lap so rounding errors cannot build up
+    if (current_index_ == 0) {
+        ResyncWindowSums();
     }
 }
 
-double PerformanceUtils::FPSCounter::GetCurrentFPS() const {
-    if (!buffer_full_ && current_index_ < 2) return 0.0;
-    
-    size_t count = buffer_full_ ? window_size_ : current_index_;
-    size_t prev_index = (current_index_ - 1 + window_size_) % window_size_;
-    size_t start_index = (current_index_ - count + window_size_) % window_size_;
-    
-    auto duration = timestamps_[prev_index] - timestamps_[start_index];
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
-    
-    return ms > 0 ? static_cast<double>(count - 1) * 1000.0 / static_cast<double>(ms) : 0.0;
+void PerformanceUtils::FPSCounter::ResyncWindowSums() {
+    interval_sum_ms_ = 0.0;
+    interval_sq_sum_ms_ = 0.0;
+    size_t oldest = (current_index_ + window_size_ - window_frames_) % window_size_;
+    for (size_t i = 1; i < window_frames_; ++i) {
+        double interval = IntervalMs(timestamps_[(oldest + i) % window_size_] -
+                                     timestamps_[(oldest + i - 1) % window_size_]);
+        interval_sum_ms_ += interval;
+        interval_sq_sum_ms_ += interval * interval;
+    }
 }
 
-double PerformanceUtils::FPSCounter::GetAverageFPS() const {
-    return GetCurrentFPS(); // Same calculation for now
-}
+double PerformanceUtils::FPSCounter::GetInstantFPS() const {
+    if (window_frames_ < 2) return 0.0;
 
-void PerformanceUtils::FPSCounter::Reset() {
-    current_index_ = 0;
-    buffer_full_ = false;
+    size_t previous = (current_index_ + window_size_ - 2) % window_size_;
+    double ms = IntervalMs(last_timestamp_ - timestamps_[previous]);
+    return ms > 0.0 ? 1000.0 / ms : 0.0;
 }
 
-// MemoryUtils implementation
-size_t MemoryUtils::GetImageMemorySize(const cv::Mat& image) {
-    return image.total() * image.elemSize();
-}
+double PerformanceUtils::FPSCounter::GetCurrentFPS() const {
+    if (window_frames_ < 2) return 0.0;
 
-size_t MemoryUtils::GetTensorMemorySize(const std::vector<int64_t>& shape, size_t element_size) {
-    size_t total_elements = 1;
-    for (auto dim : shape) {
-        total_elements *= static_cast<size_t>(dim);
-    }
-    return total_elements * element_size;
+    size_t oldest = (current_index_ + window_size_ - window_frames_) % window_size_;
+    double ms = IntervalMs(last_timestamp_ - timestamps_[oldest]);
+    return ms > 0.0 ? static_cast<double>(window_frames_ - 1) * 1000.0 / ms : 0.0;
 }
 
-std::string MemoryUtils::FormatBytes(size_t bytes) {
-    const char* units[] = {"B", "KB", "MB", "GB", "TB"};
-    double size = static_cast<double>(bytes);
-    int unit_index = 0;
-    
-    while (size >= 1024.0 && unit_index < 4) {
-        size /= 1024.0;
-        unit_index++;
-    }
-    
-    char buffer[32];
-    snprintf(buffer, sizeof(buffer), "%.2f %s", size, units[unit_index]);
-    return std::string(buffer);
+double PerformanceUtils::FPSCounter::GetAverageFPS() const {
+    if (frame_count_ < 2) return 0.0;
+
+    double ms = IntervalMs(last_timestamp_ - first_timestamp_);
+    return ms > 0.0 ? static_cast<double>(frame_count_ - 1) * 1000.0 / ms : 0.0;
 }
 
-size_t MemoryUtils::GetSystemMemoryUsage() {
-    // Platform-specific implementation needed
-    // This is a placeholder
-    return 0;
+double PerformanceUtils::FPSCounter::GetIntervalStdDevMs() const {
+    if (window_frames_ < 3) return 0.0;
+
+    auto intervals = static_cast<double>(window_frames_ - 1);
+    double mean = interval_sum_ms_ / intervals;
+    return std::sqrt(std::max(0.0, interval_sq_sum_ms_ / intervals - mean * mean));
 }
 
-size_t MemoryUtils::GetProcessMemoryUsage() {
-    // Platform-specific implementation needed
-    // This is a placeholder
-    return 0;
+void PerformanceUtils::FPSCounter::Reset() {
+    current_index_ = 0;
+    window_frames_ = 0;
+    frame_count_ = 0;
+    deadline_misses_ = 0;
+    interval_sum_ms_ = 0.0;
+    interval_sq_sum_ms_ = 0.0;
 }
 
 } // namespace utils
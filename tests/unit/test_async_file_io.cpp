@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/AsyncFileIO.hpp>
+#include <vision-infra/core/FileSystem.hpp>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/stat.h>
+#endif
+
+using namespace vision_infra::core;
+
+class AsyncFileIOTest : public ::testing::TestWithParam<AsyncIOBackend> {
+protected:
+    void SetUp() override {
+        if (GetParam() == AsyncIOBackend::IO_URING && !AsyncFileIO::IsIoUringAvailable()) {
+            GTEST_SKIP() << "io_uring is not available here";
+        }
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_async_io_test";
+        std::filesystem::remove_all(temp_dir_);
+        std::filesystem::create_directories(temp_dir_);
+
+        AsyncIOOptions options;
+        options.backend = GetParam();
+        options.queue_depth = 8;
+        io_ = std::make_unique<AsyncFileIO>(options);
+    }
+
+    void TearDown() override {
+        io_.reset();
+        std::filesystem::remove_all(temp_dir_);
+    }
+
+    std::string PathFor(size_t index) const {
+        return (temp_dir_ / ("frame_" + std::to_string(index) + ".bin")).string();
+    }
+
+    static std::vector<uint8_t> Payload(size_t index) {
+        std::vector<uint8_t> data(1000 + index * 777);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(i * 7 + index);
+        }
+        return data;
+    }
+
+    std::filesystem::path temp_dir_;
+    std::unique_ptr<AsyncFileIO> io_;
+};
+
+TEST_P(AsyncFileIOTest, WritesThenReadsManyFilesConcurrently) {
+    EXPECT_EQ(io_->GetBackend(), GetParam());
+    constexpr size_t kFiles = 40;  // More than the queue depth
+
+    std::vector<std::future<bool>> writes;
+    for (size_t i = 0; i < kFiles; ++i) {
+        writes.push_back(io_->WriteFile(PathFor(i), Payload(i)));
+    }
+    for (auto& write : writes) {
+        EXPECT_TRUE(write.get());
+    }
+
+    std::vector<std::future<std::optional<std::vector<uint8_t>>>> reads;
+    for (size_t i = 0; i < kFiles; ++i) {
+        reads.push_back(io_->ReadFile(PathFor(i)));
+    }
+    for (size_t i = 0; i < kFiles; ++i) {
+        auto content = reads[i].get();
+        ASSERT_TRUE(content.has_value());
+        EXPECT_EQ(*content, Payload(i));
+    }
+}
+
+TEST_P(AsyncFileIOTest, ReportsFailuresAndEmptyFiles) {
+    EXPECT_FALSE(io_->ReadFile((temp_dir_ / "missing.bin").string()).get().has_value());
+    EXPECT_FALSE(io_->WriteFile((temp_dir_ / "missing" / "out.bin").string(), Payload(0)).get());
+
+    ASSERT_TRUE(io_->WriteFile(PathFor(0), {}).get());
+    auto empty = io_->ReadFile(PathFor(0)).get();
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(empty->empty());
+}
+
+#ifdef __linux__
+TEST_P(AsyncFileIOTest, ReadsFilesWithoutKnownSizeUntilEof) {
+    // /proc files report a size of 0
+    std::ifstream proc("/proc/self/mountinfo", std::ios::binary);
+    std::ostringstream contents;
+    contents << proc.rdbuf();
+    std::string expected = contents.str();
+    auto mounts = io_->ReadFile("/proc/self/mountinfo").get();
+    ASSERT_TRUE(mounts.has_value());
+    EXPECT_FALSE(mounts->empty());
+    EXPECT_EQ(std::string(mounts->begin(), mounts->end()).substr(0, 64), expected.substr(0, 64));
+
+    // A FIFO has no size at all; the payload spans several read buffers
+    auto fifo = (temp_dir_ / "frames.fifo").string();
+    ASSERT_EQ(::mkfifo(fifo.c_str(), 0600), 0);
+    auto payload = Payload(400);
+    auto read = io_->ReadFile(fifo);
+    std::thread writer([&fifo, &payload] {
+        std::ofstream out(fifo, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    });
+    auto content = read.get();
+    writer.join();
+    ASSERT_TRUE(content.has_value());
+    EXPECT_EQ(*content, payload);
+}
+#endif
+
+TEST_P(AsyncFileIOTest, CallbacksRunBeforeDestructorReturns) {
+    std::atomic<int> completed{0};
+    for (size_t i = 0; i < 16; ++i) {
+        io_->WriteFile(PathFor(i), Payload(i), [&completed](bool ok) {
+            if (ok) {
+                completed.fetch_add(1);
+            }
+        });
+    }
+    io_.reset();
+    EXPECT_EQ(completed.load(), 16);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, AsyncFileIOTest,
+                         ::testing::Values(AsyncIOBackend::THREAD_POOL, AsyncIOBackend::IO_URING));
+
+TEST(FileSystemAsyncTest, RoundTripsThroughDefaultEngine) {
+    auto path = (std::filesystem::temp_directory_path() / "vision_infra_async_fs.bin").string();
+    FileSystem fs;
+
+    ASSERT_TRUE(fs.WriteFileAsync(path, {1, 2, 3}).get());
+    auto content = fs.ReadFileAsync(path).get();
+    ASSERT_TRUE(content.has_value());
+    EXPECT_EQ(*content, (std::vector<uint8_t>{1, 2, 3}));
+    std::filesystem::remove(path);
+}
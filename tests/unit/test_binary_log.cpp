@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/BinaryLogReader.hpp>
+#include <vision-infra/core/BinaryLogSink.hpp>
+#include <vision-infra/core/Logger.hpp>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vision_infra::core;
+
+class BinaryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_binlog_test";
+        std::filesystem::remove_all(temp_dir_);
+        std::filesystem::create_directories(temp_dir_);
+        path_ = (temp_dir_ / "trace.vlog").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir_);
+    }
+
+    // Entries point into the reader, which stays open until the next call
+    std::vector<BinaryLogEntry> ReadEntries() {
+        reader_ = std::make_unique<BinaryLogReader>(path_);
+        std::vector<BinaryLogEntry> entries;
+        BinaryLogEntry entry;
+        while (reader_->Next(entry)) {
+            entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    std::filesystem::path temp_dir_;
+    std::string path_;
+    std::unique_ptr<BinaryLogReader> reader_;
+};
+
+TEST_F(BinaryLogTest, RoundTripsRecordsAndArguments) {
+    {
+        BinaryLogSink sink(path_);
+        uint32_t detector = sink.RegisterLogger("detector");
+        EXPECT_EQ(sink.RegisterLogger("detector"), detector);
+        sink.Write(LogLevel::INFO, detector, "class={} score={:.2f} box=[{},{}]", "person", 0.875f, -3, 40u);
+        sink.Write(LogLevel::WARN, detector, "dropped={} ok={} tag={}", uint64_t{7}, false, 'x');
+        sink.WriteMessage(LogLevel::ERROR, detector, "plain {} text");
+    }
+
+    auto entries = ReadEntries();
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[0].level, LogLevel::INFO);
+    EXPECT_EQ(entries[0].logger_name, "detector");
+    EXPECT_EQ(entries[0].format, "class={} score={:.2f} box=[{},{}]");
+    EXPECT_EQ(entries[0].message, "class=person score=0.88 box=[-3,40]");
+    EXPECT_EQ(entries[1].message, "dropped=7 ok=false tag=x");
+    EXPECT_EQ(entries[2].level, LogLevel::ERROR);
+    EXPECT_EQ(entries[2].message, "plain {} text");
+    EXPECT_LE(entries[0].time, entries[2].time);
+}
+
+TEST_F(BinaryLogTest, GrowsBeyondInitialMapping) {
+    BinaryLogOptions options;
+    options.initial_size = 4096;
+    {
+        BinaryLogSink sink(path_, options);
+        uint32_t id = sink.RegisterLogger("frames");
+        for (int i = 0; i < 2000; ++i) {
+            sink.Write(LogLevel::TRACE, id, "frame {} latency {:.1f}ms", i, 1.5);
+        }
+        EXPECT_GT(sink.GetBytesWritten(), options.initial_size);
+    }
+
+    auto entries = ReadEntries();
+    ASSERT_EQ(entries.size(), 2000);
+    EXPECT_EQ(entries.back().message, "frame 1999 latency 1.5ms");
+}
+
+TEST_F(BinaryLogTest, TruncatedRecordEndsTheLog) {
+    uint64_t full_size = 0;
+    {
+        BinaryLogSink sink(path_);
+        uint32_t id = sink.RegisterLogger("crash");
+        sink.Write(LogLevel::INFO, id, "first {}", 1);
+        sink.Write(LogLevel::INFO, id, "second {}", 2);
+        full_size = sink.GetBytesWritten();
+    }
+    std::filesystem::resize_file(path_, full_size - 3);
+
+    auto entries = ReadEntries();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].message, "first 1");
+}
+
+TEST_F(BinaryLogTest, LoggerWritesBinaryAndReaderRendersPattern) {
+    auto sink = std::make_shared<BinaryLogSink>(path_);
+    {
+        Logger logger("pipeline");
+        logger.EnableConsoleOutput(false);
+        logger.SetBinaryOutput(sink);
+        logger.Info("objects={}", 12);
+        logger.Warn("camera offline");
+        logger.Debug("filtered {}", 0);
+    }
+    sink.reset();
+
+    BinaryLogReader reader(path_);
+    reader.SetPattern("[{level}] [{name}] {message}");
+    std::vector<std::string> lines;
+    BinaryLogEntry entry;
+    while (reader.Next(entry)) {
+        std::string line;
+        reader.FormatEntry(entry, line);
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], "[INFO] [pipeline] objects=12");
+    EXPECT_EQ(lines[1], "[WARN] [pipeline] camera offline");
+}
+
+TEST_F(BinaryLogTest, LogMacroStoresFormatAndArguments) {
+    auto sink = std::make_shared<BinaryLogSink>(path_);
+    {
+        Logger logger("macro");
+        logger.EnableConsoleOutput(false);
+        logger.SetBinaryOutput(sink);
+        VISION_INFRA_LOG_TO(logger, LogLevel::INFO, "frame {} took {:.1f}ms", 7, 2.5);
+        VISION_INFRA_LOG_TO(logger, LogLevel::WARN, "no arguments");
+    }
+    sink.reset();
+
+    auto entries = ReadEntries();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].format, "frame {} took {:.1f}ms");
+    EXPECT_EQ(entries[0].message, "frame 7 took 2.5ms");
+    EXPECT_EQ(entries[1].message, "no arguments");
+}
+
+TEST_F(BinaryLogTest, RejectsNonBinaryLogFiles) {
+    EXPECT_THROW(BinaryLogReader((temp_dir_ / "missing.vlog").string()), std::runtime_error);
+}
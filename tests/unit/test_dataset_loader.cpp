@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <vision-infra/utils/DatasetLoader.hpp>
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+using namespace vision_infra;
+using namespace vision_infra::utils;
+
+class DatasetLoaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_dataset_test";
+        std::filesystem::remove_all(temp_dir_);
+        std::filesystem::create_directories(temp_dir_ / "sub");
+        pool_ = std::make_unique<core::ThreadPool>(4);
+
+        // Each image is filled with its index so samples can be told apart
+        for (int i = 0; i < kImages; ++i) {
+            cv::Mat image(24 + i, 32, CV_8UC3, cv::Scalar(i, i, i));
+            auto dir = i % 2 ? temp_dir_ / "sub" : temp_dir_;
+            char name[32];
+            std::snprintf(name, sizeof(name), "%03d.png", i);
+            cv::imwrite((dir / name).string(), image);
+        }
+        std::ofstream(temp_dir_ / "notes.txt") << "not an image";
+
+        options_.preprocess.target_size = cv::Size(16, 16);
+        options_.preprocess.scale = 1.0f;
+        options_.prefetch_depth = 3;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir_);
+    }
+
+    static constexpr int kImages = 10;
+    std::filesystem::path temp_dir_;
+    std::unique_ptr<core::ThreadPool> pool_;
+    DatasetLoaderOptions options_;
+};
+
+TEST_F(DatasetLoaderTest, FindImagesListsOnlyImages) {
+    auto paths = DatasetLoader::FindImages(temp_dir_.string(), *pool_);
+    EXPECT_EQ(paths.size(), static_cast<size_t>(kImages));
+    EXPECT_TRUE(std::is_sorted(paths.begin(), paths.end()));
+
+    EXPECT_EQ(DatasetLoader::FindImages(temp_dir_.string(), *pool_, false).size(), kImages / 2u);
+}
+
+TEST_F(DatasetLoaderTest, OrderedDeliveryMatchesPathOrder) {
+    auto paths = DatasetLoader::FindImages(temp_dir_.string(), *pool_);
+    DatasetLoader loader(paths, options_, *pool_);
+    ASSERT_EQ(loader.Size(), paths.size());
+
+    DatasetSample sample;
+    size_t expected = 0;
+    while (loader.Next(sample)) {
+        ASSERT_TRUE(sample.ok) << sample.path;
+        EXPECT_EQ(sample.index, expected);
+        EXPECT_EQ(sample.path, paths[expected]);
+        EXPECT_EQ(sample.channels, 3);
+        ASSERT_EQ(sample.tensor.size(), 3u * 16 * 16);
+
+        // The image centre is never padding
+        int value = std::stoi(std::filesystem::path(sample.path).stem().string());
+        EXPECT_FLOAT_EQ(sample.tensor[8 * 16 + 8], static_cast<float>(value));
+        EXPECT_EQ(sample.original_size, cv::Size(32, 24 + value));
+        ++expected;
+    }
+    EXPECT_EQ(expected, paths.size());
+    EXPECT_FALSE(loader.Next(sample));
+}
+
+TEST_F(DatasetLoaderTest, UnorderedDeliversEverySampleOnce) {
+    auto paths = DatasetLoader::FindImages(temp_dir_.string(), *pool_);
+    options_.ordered = false;
+    DatasetLoader loader(paths, options_, *pool_);
+
+    std::set<size_t> seen;
+    DatasetSample sample;
+    while (loader.Next(sample)) {
+        EXPECT_TRUE(sample.ok);
+        EXPECT_TRUE(seen.insert(sample.index).second);
+    }
+    EXPECT_EQ(seen.size(), paths.size());
+}
+
+TEST_F(DatasetLoaderTest, FailedFilesAreReportedNotSkipped) {
+    std::vector<std::string> paths = {
+        (temp_dir_ / "000.png").string(),
+        (temp_dir_ / "notes.txt").string(),
+        (temp_dir_ / "missing.png").string(),
+        (temp_dir_ / "002.png").string(),
+    };
+    DatasetLoader loader(paths, options_, *pool_);
+
+    std::vector<float> batch(4 * 3 * 16 * 16, -1.0f);
+    std::vector<DatasetSample> samples;
+    EXPECT_EQ(loader.NextBatch(4, batch, samples), 2u);
+    ASSERT_EQ(samples.size(), 4u);
+    EXPECT_TRUE(samples[0].ok);
+    EXPECT_FALSE(samples[1].ok);
+    EXPECT_FALSE(samples[2].ok);
+    EXPECT_TRUE(samples[3].ok);
+    EXPECT_TRUE(samples[3].tensor.empty());
+
+    // Second image in slot 1, unused slots zeroed
+    EXPECT_FLOAT_EQ(batch[3 * 16 * 16 + 8 * 16 + 8], 2.0f);
+    EXPECT_FLOAT_EQ(batch.back(), 0.0f);
+
+    EXPECT_EQ(loader.NextBatch(4, batch, samples), 0u);
+    EXPECT_TRUE(samples.empty());
+}
+
+TEST_F(DatasetLoaderTest, SmallBatchBufferIsRejectedBeforeTakingSamples) {
+    auto paths = DatasetLoader::FindImages(temp_dir_.string(), *pool_);
+    DatasetLoader loader(paths, options_, *pool_);
+
+    std::vector<float> small(2 * 3 * 16 * 16 - 1);
+    std::vector<DatasetSample> samples;
+    EXPECT_THROW(loader.NextBatch(2, small, samples), std::invalid_argument);
+
+    std::vector<float> batch(2 * 3 * 16 * 16);
+    EXPECT_EQ(loader.NextBatch(2, batch, samples), 2u);
+    ASSERT_EQ(samples.size(), 2u);
+    EXPECT_EQ(samples[0].index, 0u);
+}
+
+TEST_F(DatasetLoaderTest, DestroyingEarlyWaitsForPrefetch) {
+    auto paths = DatasetLoader::FindImages(temp_dir_.string(), *pool_);
+    DatasetLoader loader(paths, options_, *pool_);
+    DatasetSample sample;
+    EXPECT_TRUE(loader.Next(sample));
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/DirectoryScanner.hpp>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace vision_infra::core;
+
+class DirectoryScannerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root_ = std::filesystem::temp_directory_path() / "vision_infra_scan_test";
+        std::filesystem::remove_all(root_);
+        pool_ = std::make_unique<ThreadPool>(4);
+
+        // 8 directories x 2 levels, each with two images, a video and a text file
+        for (int a = 0; a < 8; ++a) {
+            for (int b = 0; b < 2; ++b) {
+                auto dir = root_ / ("seq" + std::to_string(a)) / ("cam" + std::to_string(b));
+                std::filesystem::create_directories(dir);
+                Touch(dir / "000.jpg");
+                Touch(dir / "001.PNG");
+                Touch(dir / "clip.mp4");
+                Touch(dir / "notes.txt");
+            }
+        }
+        Touch(root_ / "model.onnx");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(root_);
+    }
+
+    static void Touch(const std::filesystem::path& path) {
+        std::ofstream(path) << "x";
+    }
+
+    std::filesystem::path root_;
+    std::unique_ptr<ThreadPool> pool_;
+};
+
+TEST_F(DirectoryScannerTest, FiltersByMediaType) {
+    ScanOptions options;
+    options.media_types = {MediaType::IMAGE};
+    DirectoryScanner scanner(options);
+
+    auto sequential = scanner.ScanAll(root_.string());
+    EXPECT_EQ(sequential.size(), 32u);
+    EXPECT_EQ(scanner.ScanAll(root_.string(), *pool_), sequential);
+
+    ScanOptions models;
+    models.media_types = {MediaType::MODEL, MediaType::VIDEO};
+    EXPECT_EQ(DirectoryScanner(models).ScanAll(root_.string(), *pool_).size(), 17u);
+
+    EXPECT_EQ(DirectoryScanner().ScanAll(root_.string()).size(), 65u);
+}
+
+TEST_F(DirectoryScannerTest, NonRecursiveListsTopLevelOnly) {
+    ScanOptions options;
+    options.recursive = false;
+    auto files = DirectoryScanner(options).ScanAll(root_.string(), *pool_);
+
+    ASSERT_EQ(files.size(), 1u);
+    EXPECT_EQ(files[0], (root_ / "model.onnx").string());
+    EXPECT_TRUE(DirectoryScanner().ScanAll((root_ / "missing").string()).empty());
+}
+
+TEST_F(DirectoryScannerTest, ParallelScanReportsEachFileOnce) {
+    std::atomic<size_t> images{0};
+    std::atomic<size_t> videos{0};
+    DirectoryScanner scanner;
+
+    auto count = scanner.Scan(root_.string(), [&](const ScanEntry& entry) {
+        if (entry.media_type == MediaType::IMAGE) {
+            images.fetch_add(1);
+        } else if (entry.media_type == MediaType::VIDEO) {
+            videos.fetch_add(1);
+        }
+    }, *pool_);
+
+    EXPECT_EQ(count, 65u);
+    EXPECT_EQ(images.load(), 32u);
+    EXPECT_EQ(videos.load(), 16u);
+}
+
+TEST_F(DirectoryScannerTest, CallbackExceptionStopsScan) {
+    DirectoryScanner scanner;
+    EXPECT_THROW(scanner.Scan(root_.string(), [](const ScanEntry&) { throw std::runtime_error("stop"); }, *pool_),
+                 std::runtime_error);
+}
+
+TEST_F(DirectoryScannerTest, StreamDeliversEntriesThroughBoundedQueue) {
+    ScanOptions options;
+    options.media_types = {MediaType::IMAGE};
+    DirectoryScanner scanner(options);
+
+    auto stream = scanner.Stream(root_.string(), *pool_, 4);
+    std::vector<std::string> paths;
+    ScanEntry entry;
+    while (stream->Next(entry)) {
+        EXPECT_EQ(entry.media_type, MediaType::IMAGE);
+        paths.push_back(entry.path);
+    }
+    std::sort(paths.begin(), paths.end());
+    EXPECT_EQ(paths, scanner.ScanAll(root_.string()));
+
+    // Abandoning a stream early cancels the rest of the walk
+    auto partial = scanner.Stream(root_.string(), *pool_, 1);
+    EXPECT_TRUE(partial->Next(entry));
+    partial.reset();
+}
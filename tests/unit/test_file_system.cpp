@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/FileSystem.hpp>
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace vision_infra::core;
+
+class FileSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_fs_test";
+        std::filesystem::remove_all(temp_dir_);
+        std::filesystem::create_directories(temp_dir_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir_);
+    }
+
+    std::string WriteRaw(const std::string& name, const std::string& content) const {
+        auto path = (temp_dir_ / name).string();
+        std::ofstream file(path, std::ios::binary);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return path;
+    }
+
+    std::filesystem::path temp_dir_;
+    FileSystem fs_;
+};
+
+TEST_F(FileSystemTest, ReadFileReturnsExactBytes) {
+    const std::string content("line1\r\nline2\0tail", 17);
+    auto path = WriteRaw("data.bin", content);
+
+    auto text = fs_.ReadFile(path);
+    ASSERT_TRUE(text.has_value());
+    EXPECT_EQ(*text, content);
+
+    auto bytes = fs_.ReadBinaryFile(path);
+    ASSERT_TRUE(bytes.has_value());
+    EXPECT_EQ(std::string(bytes->begin(), bytes->end()), content);
+
+    EXPECT_FALSE(fs_.ReadFile((temp_dir_ / "missing").string()).has_value());
+}
+
+TEST_F(FileSystemTest, ReadBinaryFileHandlesLargeAndEmptyFiles) {
+    std::string large(3 * 1024 * 1024 + 7, '\0');
+    for (size_t i = 0; i < large.size(); ++i) {
+        large[i] = static_cast<char>(i * 31);
+    }
+    auto bytes = fs_.ReadBinaryFile(WriteRaw("large.bin", large));
+    ASSERT_TRUE(bytes.has_value());
+    ASSERT_EQ(bytes->size(), large.size());
+    EXPECT_TRUE(std::equal(bytes->begin(), bytes->end(), large.begin(),
+                           [](uint8_t a, char b) { return a == static_cast<uint8_t>(b); }));
+
+    auto empty = fs_.ReadBinaryFile(WriteRaw("empty.bin", ""));
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(empty->empty());
+}
+
+TEST_F(FileSystemTest, MapFileProvidesReadOnlyView) {
+    const std::string content = "labels\nperson\ncar\n";
+    auto path = WriteRaw("labels.txt", content);
+
+    auto mapped = fs_.MapFile(path, MappedFile::AccessHint::SEQUENTIAL);
+    ASSERT_TRUE(mapped.has_value());
+    EXPECT_EQ(mapped->Size(), content.size());
+    EXPECT_EQ(mapped->Text(), content);
+    EXPECT_EQ(mapped->Bytes()[0], static_cast<uint8_t>('l'));
+
+    MappedFile moved = std::move(*mapped);
+    EXPECT_TRUE(mapped->Empty());
+    EXPECT_EQ(moved.Text(), content);
+
+    auto empty = fs_.MapFile(WriteRaw("empty.txt", ""));
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(empty->Empty());
+
+    EXPECT_FALSE(fs_.MapFile((temp_dir_ / "missing").string()).has_value());
+    EXPECT_FALSE(fs_.MapFile(temp_dir_.string()).has_value());
+}
+
+TEST_F(FileSystemTest, WriteFileIsBinarySafe) {
+    const std::string content("a\r\nb\0c\n", 7);
+    auto path = (temp_dir_ / "out.bin").string();
+
+    ASSERT_TRUE(fs_.WriteFile(path, content));
+    EXPECT_EQ(fs_.ReadFile(path).value(), content);
+
+    const std::vector<uint8_t> tail = {0x00, 0xff, 0x10};
+    FileWriteOptions append;
+    append.append = true;
+    ASSERT_TRUE(fs_.WriteBinaryFile(path, tail, append));
+    EXPECT_EQ(fs_.GetFileSize(path).value(), content.size() + tail.size());
+
+    EXPECT_FALSE(fs_.WriteFile((temp_dir_ / "missing" / "out.bin").string(), content));
+}
+
+TEST_F(FileSystemTest, WriterBuffersAndBypassesLargeChunks) {
+    auto path = (temp_dir_ / "stream.bin").string();
+    FileWriteOptions options;
+    options.buffer_size = 16;
+
+    std::string expected;
+    {
+        auto writer = fs_.OpenWriter(path, options);
+        ASSERT_TRUE(writer.has_value());
+        for (int i = 0; i < 10; ++i) {
+            std::string chunk(static_cast<size_t>(i * 3), static_cast<char>('a' + i));
+            EXPECT_TRUE(writer->Write(chunk));
+            expected += chunk;
+        }
+        EXPECT_EQ(writer->BytesWritten(), expected.size());
+    }  // Non-atomic writers commit on destruction
+
+    EXPECT_EQ(fs_.ReadFile(path).value(), expected);
+}
+
+TEST_F(FileSystemTest, AtomicWriterReplacesOnlyOnCommit) {
+    auto path = WriteRaw("frame.bin", "old");
+    FileWriteOptions options;
+    options.atomic = true;
+
+    {
+        auto writer = fs_.OpenWriter(path, options);
+        ASSERT_TRUE(writer.has_value());
+        EXPECT_TRUE(writer->Write(std::string_view("partial")));
+    }  // Dropped without Commit()
+    EXPECT_EQ(fs_.ReadFile(path).value(), "old");
+    EXPECT_EQ(fs_.ListFiles(temp_dir_.string()).size(), 1u);
+
+    auto writer = fs_.OpenWriter(path, options);
+    ASSERT_TRUE(writer.has_value());
+    EXPECT_TRUE(writer->Write(std::string_view("new contents")));
+    EXPECT_EQ(fs_.ReadFile(path).value(), "old");
+    EXPECT_TRUE(writer->Commit());
+    EXPECT_EQ(fs_.ReadFile(path).value(), "new contents");
+    EXPECT_EQ(fs_.ListFiles(temp_dir_.string()).size(), 1u);
+
+    options.append = true;
+    EXPECT_FALSE(fs_.OpenWriter(path, options).has_value());
+}
+
+// Implements only the original interface, like file systems injected before
+// the binary and async members existed
+class InMemoryFileSystem : public IFileSystem {
+public:
+    bool Exists(const std::string& path) const override { return files_.count(path) != 0; }
+    bool IsFile(const std::string& path) const override { return Exists(path); }
+    bool IsDirectory(const std::string&) const override { return false; }
+    bool CreateDirectory(const std::string&) const override { return false; }
+    bool CreateDirectories(const std::string&) const override { return false; }
+    bool Remove(const std::string& path) const override { return files_.erase(path) != 0; }
+    bool RemoveAll(const std::string& path) const override { return Remove(path); }
+    std::optional<std::string> ReadFile(const std::string& path) const override {
+        auto it = files_.find(path);
+        return it != files_.end() ? std::optional<std::string>(it->second) : std::nullopt;
+    }
+    bool WriteFile(const std::string& path, const std::string& content) const override {
+        files_[path] = content;
+        return true;
+    }
+    std::vector<std::string> ListFiles(const std::string&) const override { return {}; }
+    std::vector<std::string> ListDirectories(const std::string&) const override { return {}; }
+    std::optional<size_t> GetFileSize(const std::string& path) const override {
+        auto content = ReadFile(path);
+        return content ? std::optional<size_t>(content->size()) : std::nullopt;
+    }
+    std::optional<std::string> GetFileExtension(const std::string&) const override { return std::nullopt; }
+    std::string GetFileName(const std::string& path) const override { return path; }
+    std::string GetDirectoryName(const std::string&) const override { return {}; }
+    std::string JoinPath(const std::string& left, const std::string& right) const override {
+        return left + "/" + right;
+    }
+    std::string GetAbsolutePath(const std::string& path) const override { return path; }
+    std::string GetCurrentWorkingDirectory() const override { return "/"; }
+
+private:
+    mutable std::map<std::string, std::string> files_;
+};
+
+TEST(FileSystemInterfaceTest, DefaultsBuildOnReadFileAndWriteFile) {
+    InMemoryFileSystem fs;
+    const std::vector<uint8_t> bytes = {'a', 0, 'b', 0xff};
+
+    EXPECT_TRUE(fs.WriteBinaryFile("frame.bin", bytes));
+    EXPECT_EQ(fs.ReadFile("frame.bin"), std::string("a\0b\xff", 4));
+    EXPECT_EQ(fs.ReadBinaryFile("frame.bin"), bytes);
+    EXPECT_FALSE(fs.ReadBinaryFile("missing.bin").has_value());
+
+    FileWriteOptions append;
+    append.append = true;
+    EXPECT_TRUE(fs.WriteBinaryFile("frame.bin", bytes, append));
+    EXPECT_EQ(fs.ReadBinaryFile("frame.bin")->size(), 2 * bytes.size());
+
+    EXPECT_TRUE(fs.WriteFileAsync("async.bin", bytes).get());
+    EXPECT_EQ(fs.ReadFileAsync("async.bin").get(), bytes);
+    EXPECT_FALSE(fs.ReadFileAsync("missing.bin").get().has_value());
+}
+
+TEST(FileSystemUtilsTest, ClassifiesByExtension) {
+    EXPECT_EQ(FileSystemUtils::GetMediaType("frames/000.JPG"), MediaType::IMAGE);
+    EXPECT_EQ(FileSystemUtils::GetMediaType("clip.mkv"), MediaType::VIDEO);
+    EXPECT_EQ(FileSystemUtils::GetMediaType("/models/yolo.onnx"), MediaType::MODEL);
+    EXPECT_EQ(FileSystemUtils::GetMediaType("notes.txt"), MediaType::UNKNOWN);
+    EXPECT_EQ(FileSystemUtils::GetMediaType("dir.png/README"), MediaType::UNKNOWN);
+    EXPECT_EQ(FileSystemUtils::GetMediaType(".png"), MediaType::UNKNOWN);
+
+    EXPECT_TRUE(FileSystemUtils::IsImageFile("a.tiff"));
+    EXPECT_FALSE(FileSystemUtils::IsVideoFile("a.tiff"));
+    EXPECT_TRUE(FileSystemUtils::IsModelFile("weights.PT"));
+}
+
+TEST(FileSystemUtilsTest, EverySupportedExtensionClassifies) {
+    for (auto extension : FileSystemUtils::GetSupportedImageExtensions()) {
+        EXPECT_EQ(ClassifyExtension(extension), MediaType::IMAGE) << extension;
+    }
+    for (auto extension : FileSystemUtils::GetSupportedVideoExtensions()) {
+        EXPECT_EQ(ClassifyExtension(extension), MediaType::VIDEO) << extension;
+    }
+    for (auto extension : FileSystemUtils::GetSupportedModelExtensions()) {
+        std::string upper(extension);
+        std::transform(upper.begin(), upper.end(), upper.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+        EXPECT_EQ(ClassifyExtension(upper), MediaType::MODEL) << upper;
+    }
+
+    EXPECT_EQ(ClassifyExtension(""), MediaType::UNKNOWN);
+    EXPECT_EQ(ClassifyExtension("."), MediaType::UNKNOWN);
+    EXPECT_EQ(ClassifyExtension(".jpgx"), MediaType::UNKNOWN);
+    EXPECT_EQ(ClassifyExtension(".savedmodels"), MediaType::UNKNOWN);
+    EXPECT_EQ(PathExtension("C:\\data\\img.Png"), ".Png");
+    EXPECT_EQ(PathExtension("archive.tar.gz"), ".gz");
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <vision-infra/utils/ImageCache.hpp>
+#include <opencv2/opencv.hpp>
+#include <chrono>
+#include <filesystem>
+
+using namespace vision_infra::utils;
+
+class ImageCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_image_cache_test";
+        std::filesystem::remove_all(temp_dir_);
+        std::filesystem::create_directories(temp_dir_);
+        for (int i = 0; i < 3; ++i) {
+            WriteImage(i, cv::Scalar(10 * i, 10 * i, 10 * i));
+        }
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir_);
+    }
+
+    std::string PathFor(int index) const {
+        return (temp_dir_ / ("img" + std::to_string(index) + ".png")).string();
+    }
+
+    void WriteImage(int index, const cv::Scalar& color) const {
+        cv::imwrite(PathFor(index), cv::Mat(20, 20, CV_8UC3, color));
+    }
+
+    static constexpr size_t kImageBytes = 20 * 20 * 3;
+    std::filesystem::path temp_dir_;
+};
+
+TEST_F(ImageCacheTest, SecondLookupHits) {
+    ImageCache cache(10 * kImageBytes);
+
+    auto first = cache.GetImage(PathFor(1));
+    auto second = cache.GetImage(PathFor(1));
+    ASSERT_FALSE(first.empty());
+    EXPECT_EQ(first.data, second.data);  // Same shared pixels
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(stats.bytes, kImageBytes);
+    EXPECT_DOUBLE_EQ(stats.GetHitRate(), 0.5);
+
+    EXPECT_TRUE(cache.GetImage((temp_dir_ / "missing.png").string()).empty());
+    EXPECT_EQ(cache.GetStats().misses, 2u);
+}
+
+TEST_F(ImageCacheTest, EvictsLeastRecentlyUsedOverBudget) {
+    ImageCache cache(2 * kImageBytes);
+
+    cache.GetImage(PathFor(0));
+    cache.GetImage(PathFor(1));
+    cache.GetImage(PathFor(0));  // 1 is now least recently used
+    cache.GetImage(PathFor(2));
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_EQ(stats.evictions, 1u);
+
+    cache.ResetStats();
+    cache.GetImage(PathFor(0));
+    cache.GetImage(PathFor(1));
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+
+    cache.SetBudget(kImageBytes);
+    EXPECT_EQ(cache.GetStats().entries, 1u);
+    cache.SetBudget(kImageBytes - 1);
+    EXPECT_EQ(cache.GetStats().entries, 0u);
+    EXPECT_TRUE(cache.GetImage(PathFor(0)).data != nullptr);
+    EXPECT_EQ(cache.GetStats().entries, 0u);  // Larger than the whole budget
+}
+
+TEST_F(ImageCacheTest, ModifiedFileIsReloaded) {
+    ImageCache cache(10 * kImageBytes);
+    EXPECT_EQ(cache.GetImage(PathFor(0)).at<cv::Vec3b>(0, 0)[0], 0);
+
+    WriteImage(0, cv::Scalar(200, 200, 200));
+    std::filesystem::last_write_time(PathFor(0),
+                                     std::filesystem::last_write_time(PathFor(0)) + std::chrono::seconds(5));
+
+    EXPECT_EQ(cache.GetImage(PathFor(0)).at<cv::Vec3b>(0, 0)[0], 200);
+    EXPECT_EQ(cache.GetStats().misses, 2u);
+    EXPECT_EQ(cache.GetStats().entries, 1u);
+}
+
+TEST_F(ImageCacheTest, TensorsAreKeyedByPreprocessOptions) {
+    ImageCache cache(100 * kImageBytes);
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(8, 8);
+    options.scale = 1.0f;
+
+    auto first = cache.GetTensor(PathFor(2), options);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->channels, 3);
+    EXPECT_EQ(first->data->size(), 3u * 8 * 8);
+    EXPECT_FLOAT_EQ((*first->data)[4 * 8 + 4], 20.0f);
+
+    auto second = cache.GetTensor(PathFor(2), options);
+    EXPECT_EQ(first->data, second->data);
+
+    options.mean = {10.0f, 10.0f, 10.0f};
+    auto shifted = cache.GetTensor(PathFor(2), options);
+    EXPECT_NE(shifted->data, first->data);
+    EXPECT_FLOAT_EQ((*shifted->data)[4 * 8 + 4], 10.0f);
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.bytes, 2 * 3 * 8 * 8 * sizeof(float));
+
+    EXPECT_FALSE(cache.GetTensor((temp_dir_ / "missing.png").string(), options).has_value());
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/LatencyHistogram.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace vision_infra::core;
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMinMs(), 0.0);
+    EXPECT_EQ(histogram.GetMaxMs(), 0.0);
+    EXPECT_EQ(histogram.GetMeanMs(), 0.0);
+    EXPECT_EQ(histogram.GetPercentileMs(99.0), 0.0);
+    EXPECT_EQ(histogram.GetStats().count, 0u);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+    LatencyHistogram histogram;
+    for (int ns = 1; ns <= 20; ++ns) {
+        histogram.Record(std::chrono::nanoseconds(ns));
+    }
+    histogram.Record(-5ns);  // Counted as zero
+
+    EXPECT_EQ(histogram.GetCount(), 21u);
+    EXPECT_EQ(histogram.GetMinMs(), 0.0);
+    EXPECT_DOUBLE_EQ(histogram.GetMaxMs(), 20e-6);
+    EXPECT_DOUBLE_EQ(histogram.GetPercentileMs(50.0), 10e-6);
+    EXPECT_DOUBLE_EQ(histogram.GetMeanMs(), 210e-6 / 21);
+}
+
+TEST(LatencyHistogramTest, PercentilesWithinBucketPrecision) {
+    // Frame latencies between 1 ms and 100 ms
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int64_t> latency(1'000'000, 100'000'000);
+    std::vector<int64_t> values(100000);
+    LatencyHistogram histogram;
+    for (auto& value : values) {
+        value = latency(rng);
+        histogram.Record(std::chrono::nanoseconds(value));
+    }
+    std::sort(values.begin(), values.end());
+
+    auto stats = histogram.GetStats();
+    EXPECT_EQ(stats.count, values.size());
+    EXPECT_DOUBLE_EQ(stats.min_ms, static_cast<double>(values.front()) / 1e6);
+    EXPECT_DOUBLE_EQ(stats.max_ms, static_cast<double>(values.back()) / 1e6);
+    EXPECT_DOUBLE_EQ(histogram.GetPercentileMs(100.0), stats.max_ms);
+
+    auto exact = [&](double percentile) {
+        auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(values.size())));
+        return static_cast<double>(values[rank - 1]) / 1e6;
+    };
+    for (auto [percentile, measured] : {std::pair{50.0, stats.p50_ms}, std::pair{90.0, stats.p90_ms},
+                                        std::pair{99.0, stats.p99_ms}, std::pair{99.9, stats.p999_ms}}) {
+        EXPECT_NEAR(measured, exact(percentile), exact(percentile) / 64) << "p" << percentile;
+    }
+}
+
+TEST(LatencyHistogramTest, MergeMatchesSingleHistogram) {
+    LatencyHistogram combined;
+    LatencyHistogram first;
+    LatencyHistogram second;
+    for (int i = 1; i <= 1000; ++i) {
+        auto value = std::chrono::microseconds(i * 37 % 5000);
+        combined.Record(value);
+        (i % 2 == 0 ? first : second).Record(value);
+    }
+
+    LatencyHistogram merged;
+    merged.Merge(first);
+    merged.Merge(second);
+    auto expected = combined.GetStats();
+    auto actual = merged.GetStats();
+    EXPECT_EQ(actual.count, expected.count);
+    EXPECT_EQ(actual.min_ms, expected.min_ms);
+    EXPECT_EQ(actual.max_ms, expected.max_ms);
+    EXPECT_DOUBLE_EQ(actual.mean_ms, expected.mean_ms);
+    EXPECT_EQ(actual.p50_ms, expected.p50_ms);
+    EXPECT_EQ(actual.p999_ms, expected.p999_ms);
+
+    LatencyHistogram copy = merged;
+    merged.Reset();
+    EXPECT_EQ(merged.GetCount(), 0u);
+    EXPECT_EQ(copy.GetCount(), 1000u);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordingLosesNothing) {
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&histogram, t] {
+            for (int i = 0; i < 10000; ++i) {
+                histogram.Record(std::chrono::microseconds(t * 1000 + i % 100));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(histogram.GetCount(), 40000u);
+    EXPECT_DOUBLE_EQ(histogram.GetMinMs(), 0.0);
+    EXPECT_DOUBLE_EQ(histogram.GetMaxMs(), 3.099);
+}
+
+TEST(LatencyHistogramTest, RecordMsAndOutOfRangeValues) {
+    LatencyHistogram histogram;
+    histogram.RecordMs(16.6);
+    histogram.RecordMs(-1.0);
+    histogram.Record(std::chrono::hours(2));  // Beyond the top bucket
+
+    EXPECT_EQ(histogram.GetCount(), 3u);
+    EXPECT_DOUBLE_EQ(histogram.GetMaxMs(), 2 * 3600 * 1000.0);
+    EXPECT_NEAR(histogram.GetPercentileMs(50.0), 16.6, 16.6 / 64);
+    EXPECT_DOUBLE_EQ(histogram.GetPercentileMs(100.0), 2 * 3600 * 1000.0);
+}
+
+TEST(LatencyHistogramTest, SerializationRoundTrips) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 10000; ++i) {
+        histogram.Record(std::chrono::microseconds(16000 + (i % 50) * 20));
+    }
+    auto bytes = histogram.Serialize();
+    EXPECT_LT(bytes.size(), 200u);
+
+    auto restored = LatencyHistogram::Deserialize(bytes);
+    ASSERT_TRUE(restored.has_value());
+    auto expected = histogram.GetStats();
+    auto actual = restored->GetStats();
+    EXPECT_EQ(actual.count, expected.count);
+    EXPECT_EQ(actual.min_ms, expected.min_ms);
+    EXPECT_EQ(actual.max_ms, expected.max_ms);
+    EXPECT_EQ(actual.mean_ms, expected.mean_ms);
+    EXPECT_EQ(actual.p99_ms, expected.p99_ms);
+    EXPECT_EQ(restored->Serialize(), bytes);
+
+    auto empty = LatencyHistogram::Deserialize(LatencyHistogram().Serialize());
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_EQ(empty->GetCount(), 0u);
+    EXPECT_EQ(empty->GetMinMs(), 0.0);
+}
+
+TEST(LatencyHistogramTest, DeserializeRejectsMalformedInput) {
+    LatencyHistogram histogram;
+    histogram.Record(5ms);
+    auto bytes = histogram.Serialize();
+
+    EXPECT_FALSE(LatencyHistogram::Deserialize({}).has_value());
+    auto truncated = bytes;
+    truncated.back() |= 0x80;  // Varint continues past the end
+    EXPECT_FALSE(LatencyHistogram::Deserialize(truncated).has_value());
+    auto other_layout = bytes;
+    other_layout[1] = 3;
+    EXPECT_FALSE(LatencyHistogram::Deserialize(other_layout).has_value());
+    auto out_of_range = bytes;
+    out_of_range.insert(out_of_range.end(), {0xff, 0x7f, 0x01});  // Gap past the last bucket
+    EXPECT_FALSE(LatencyHistogram::Deserialize(out_of_range).has_value());
+}
@@ -0,0 +1,416 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/Logger.hpp>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vision_infra::core;
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_logger_test";
+        std::filesystem::create_directories(temp_dir_);
+        log_file_ = (temp_dir_ / "test.log").string();
+        std::filesystem::remove(log_file_);
+        
+        logger_ = std::make_unique<Logger>("test");
+        logger_->EnableConsoleOutput(false);
+        logger_->SetOutputFile(log_file_);
+    }
+    
+    void TearDown() override {
+        logger_.reset();
+        std::filesystem::remove_all(temp_dir_);
+    }
+    
+    std::vector<std::string> ReadLines() const {
+        std::vector<std::string> lines;
+        std::ifstream file(log_file_);
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+    
+    std::filesystem::path temp_dir_;
+    std::string log_file_;
+    std::unique_ptr<Logger> logger_;
+};
+
+TEST_F(LoggerTest, WritesFormattedMessageToFile) {
+    logger_->SetPattern("[{level}] [{name}] {message}");
+    logger_->Info("hello");
+    logger_->Debug("filtered out");
+    logger_->Flush();
+    
+    auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0], "[INFO] [test] hello");
+}
+
+TEST_F(LoggerTest, FormattedMethodsRenderArguments) {
+    logger_->SetPattern("{message}");
+    logger_->Info("class={} score={:.2f} box=[{},{},{},{}]", "person", 0.8765f, 10, 20, 110, 220);
+    logger_->Warn("{{literal}} {:04} 0x{:x} {}", 7, 255u, true);
+    logger_->Debug("filtered {}", 1);
+    logger_->Flush();
+    
+    auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], "class=person score=0.88 box=[10,20,110,220]");
+    EXPECT_EQ(lines[1], "{literal} 0007 0xff true");
+}
+
+TEST_F(LoggerTest, CompiledPatternRendersAllFields) {
+    logger_->SetPattern("{timestamp}.{ms}{us} <{thread}> {unknown} {level}:{message}");
+    logger_->Error("boom");
+    logger_->Flush();
+    
+    auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), 1);
+    std::regex expected(R"(\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d{3}\d{6} <\d+> \{unknown\} ERROR:boom)");
+    EXPECT_TRUE(std::regex_match(lines[0], expected)) << lines[0];
+}
+
+TEST_F(LoggerTest, DisabledTimestampRendersNothing) {
+    logger_->SetPattern("[{timestamp}] {message}");
+    logger_->EnableTimestamp(false);
+    logger_->Info("plain");
+    logger_->Flush();
+    
+    auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0], "[] plain");
+}
+
+TEST_F(LoggerTest, AsyncModeWritesAllRecordsInOrder) {
+    logger_->SetPattern("{message}");
+    logger_->EnableAsync();
+    EXPECT_TRUE(logger_->IsAsync());
+    
+    for (int i = 0; i < 1000; ++i) {
+        logger_->Info(std::to_string(i));
+    }
+    logger_->Flush();
+    
+    auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(lines[static_cast<size_t>(i)], std::to_string(i));
+    }
+    EXPECT_EQ(logger_->GetDroppedCount(), 0);
+}
+
+TEST_F(LoggerTest, AsyncModeFromManyThreads) {
+    logger_->SetPattern("{message}");
+    logger_->EnableAsync({64, OverflowPolicy::BLOCK});
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([this] {
+            for (int i = 0; i < 500; ++i) {
+                logger_->Warn("message");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger_->Flush();
+    
+    EXPECT_EQ(ReadLines().size(), 2000);
+    EXPECT_EQ(logger_->GetDroppedCount(), 0);
+}
+
+TEST_F(LoggerTest, AsyncDropPoliciesAccountForEveryRecord) {
+    for (auto policy : {OverflowPolicy::DROP_NEWEST, OverflowPolicy::DROP_OLDEST}) {
+        std::filesystem::remove(log_file_);
+        Logger logger("drop");
+        logger.EnableConsoleOutput(false);
+        logger.SetOutputFile(log_file_);
+        logger.SetPattern("{message}");
+        logger.EnableAsync({2, policy});
+        
+        for (int i = 0; i < 2000; ++i) {
+            logger.Info("x");
+        }
+        logger.Flush();
+        logger.DisableAsync();
+        
+        EXPECT_EQ(ReadLines().size() + logger.GetDroppedCount(), 2000);
+    }
+}
+
+TEST_F(LoggerTest, AsyncFlushReturnsWhileOthersKeepLogging) {
+    logger_->SetPattern("{message}");
+    logger_->EnableAsync();
+    
+    std::atomic<bool> stop{false};
+    std::thread producer([this, &stop] {
+        while (!stop.load()) {
+            logger_->Info("background");
+        }
+    });
+    logger_->Info("before flush");
+    auto flushed = std::async(std::launch::async, [this] { logger_->Flush(); });
+    bool returned = flushed.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+    stop = true;
+    producer.join();
+    flushed.wait();
+    EXPECT_TRUE(returned);
+    
+    logger_->DisableAsync();
+    auto lines = ReadLines();
+    EXPECT_NE(std::find(lines.begin(), lines.end(), "before flush"), lines.end());
+}
+
+TEST_F(LoggerTest, QuietLoggerFlushesAfterFlushInterval) {
+    FileSinkOptions options;
+    options.flush_interval = std::chrono::milliseconds(50);
+    for (bool async : {false, true}) {
+        logger_.reset();
+        std::filesystem::remove(log_file_);
+        logger_ = std::make_unique<Logger>("quiet");
+        logger_->EnableConsoleOutput(false);
+        logger_->SetPattern("{message}");
+        logger_->SetOutputFile(log_file_, options);
+        if (async) {
+            logger_->EnableAsync();
+        }
+        
+        // No further writes and no Flush(): the line must still reach the disk
+        logger_->Info("only line");
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        
+        auto lines = ReadLines();
+        ASSERT_EQ(lines.size(), 1) << (async ? "async" : "sync");
+        EXPECT_EQ(lines[0], "only line");
+    }
+}
+
+// Records messages so the macros can be checked without console output
+class RecordingLogger : public ILogger {
+public:
+    void Log(LogLevel level, const std::string& message) override {
+        messages.push_back(LoggerManager::LogLevelToString(level) + ":" + message);
+    }
+    void LogAt(LogLevel level, const std::string& message, const std::source_location& location) override {
+        Log(level, message);
+        last_line = location.line();
+    }
+    void SetLevel(LogLevel level) override { level_ = level; }
+    LogLevel GetLevel() const override { return level_; }
+    void Flush() override {}
+    
+    std::vector<std::string> messages;
+    unsigned last_line{0};
+    
+private:
+    LogLevel level_{LogLevel::INFO};
+};
+
+class LogMacroTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        recorder_ = std::make_shared<RecordingLogger>();
+        LoggerManager::SetDefaultLogger(recorder_);
+    }
+    
+    void TearDown() override {
+        LoggerManager::SetDefaultLogger(nullptr);
+    }
+    
+    std::shared_ptr<RecordingLogger> recorder_;
+};
+
+TEST_F(LogMacroTest, DisabledLevelDoesNotEvaluateMessage) {
+    int evaluations = 0;
+    auto build_message = [&evaluations] {
+        ++evaluations;
+        return std::string("expensive");
+    };
+    
+    LOG_DEBUG(build_message());
+    EXPECT_EQ(evaluations, 0);
+    EXPECT_TRUE(recorder_->messages.empty());
+    
+    LOG_WARN(build_message());
+    EXPECT_EQ(evaluations, 1);
+    ASSERT_EQ(recorder_->messages.size(), 1);
+    EXPECT_EQ(recorder_->messages[0], "WARN:expensive");
+}
+
+TEST_F(LogMacroTest, FormattedMacroSkipsArgumentsWhenDisabled) {
+    int evaluations = 0;
+    auto score = [&evaluations] {
+        ++evaluations;
+        return 0.5;
+    };
+    
+    LOG_DEBUG("score {}", score());
+    EXPECT_EQ(evaluations, 0);
+    
+    LOG_INFO("id={} score={:.1f} name={}", 3, score(), std::string("car"));
+    EXPECT_EQ(evaluations, 1);
+    ASSERT_EQ(recorder_->messages.size(), 1);
+    EXPECT_EQ(recorder_->messages[0], "INFO:id=3 score=0.5 name=car");
+}
+
+TEST_F(LogMacroTest, MacroPassesSourceLocation) {
+    LOG_INFO("located"); const unsigned expected_line = __LINE__;
+    
+    EXPECT_EQ(recorder_->last_line, expected_line);
+    EXPECT_EQ(&LoggerManager::GetDefaultLoggerRef(), recorder_.get());
+}
+
+struct SelfLogging {};
+
+static std::ostream& operator<<(std::ostream& os, const SelfLogging&) {
+    LOG_INFO("inner {}", 1);
+    return os << "value";
+}
+
+TEST_F(LogMacroTest, NestedLoggingKeepsOuterMessage) {
+    LOG_WARN("outer {} done", SelfLogging{});
+
+    ASSERT_EQ(recorder_->messages.size(), 2);
+    EXPECT_EQ(recorder_->messages[0], "INFO:inner 1");
+    EXPECT_EQ(recorder_->messages[1], "WARN:outer value done");
+}
+
+TEST(FormatTest, FormatsCommonTypes) {
+    EXPECT_EQ(Format("{} {} {}", -42, 1.5, 'c'), "-42 1.5 c");
+    EXPECT_EQ(Format("[{:5}] [{:05}] [{:X}]", "ab", -12, 0xbeefu), "[ab   ] [-0012] [BEEF]");
+    EXPECT_EQ(Format("{:.3e} {:.1f}", 12346.0, 2.25), "1.235e+04 2.2");
+    EXPECT_EQ(Format("{} of {}", LogLevel::WARN, std::string_view("levels")), "3 of levels");
+    EXPECT_EQ(Format("no fields {{}}"), "no fields {}");
+}
+
+TEST_F(LogMacroTest, HandleMacroLogsThroughHandle) {
+    LoggerHandle handle(*recorder_);
+    VISION_INFRA_LOG_TO(handle, LogLevel::ERROR, "code {}", 42);
+    
+    ASSERT_EQ(recorder_->messages.size(), 1);
+    EXPECT_EQ(recorder_->messages[0], "ERROR:code 42");
+}
+
+TEST(LoggerManagerTest, HandleRefersToRegisteredLogger) {
+    auto logger = LoggerManager::GetLogger("handle_test");
+    auto handle = LoggerManager::GetHandle("handle_test");
+    
+    EXPECT_EQ(&handle.Get(), logger.get());
+    EXPECT_EQ(LoggerManager::GetLogger("handle_test"), logger);
+    EXPECT_EQ(LoggerManager::GetLogger(""), LoggerManager::GetLogger("default"));
+}
+
+TEST(LoggerManagerTest, ConcurrentLookupsReturnOneLoggerPerName) {
+    constexpr size_t kThreads = 8;
+    constexpr size_t kNames = 16;
+    std::vector<std::vector<ILogger*>> seen(kThreads, std::vector<ILogger*>(kNames));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t, &seen] {
+            for (size_t n = 0; n < kNames; ++n) {
+                auto name = "concurrent_" + std::to_string(n);
+                seen[t][n] = LoggerManager::GetLogger(name).get();
+                EXPECT_EQ(&LoggerManager::GetHandle(name).Get(), seen[t][n]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    for (size_t t = 1; t < kThreads; ++t) {
+        EXPECT_EQ(seen[t], seen[0]);
+    }
+}
+
+TEST(LoggerManagerTest, ReplacedDefaultLoggerClosesItsFile) {
+    auto dir = std::filesystem::temp_directory_path() / "vision_infra_default_logger_test";
+    std::filesystem::create_directories(dir);
+    auto path = dir / "first.log";
+    std::filesystem::remove(path);
+    
+    auto first = std::make_shared<Logger>("first");
+    first->EnableConsoleOutput(false);
+    first->SetPattern("{message}");
+    first->SetOutputFile(path.string());
+    first->EnableAsync();
+    LoggerManager::SetDefaultLogger(first);
+    ILogger& first_ref = LoggerManager::GetDefaultLoggerRef();
+    first_ref.Log(LogLevel::INFO, "before replacement");
+    
+    LoggerManager::SetDefaultLogger(std::make_shared<Logger>("second"));
+    LoggerManager::SetDefaultLogger(nullptr);
+    EXPECT_NE(&LoggerManager::GetDefaultLoggerRef(), &first_ref);
+    EXPECT_EQ(&first_ref, first.get());  // Still alive for stale references
+    
+    {
+        std::ifstream file(path);
+        std::string line;
+        ASSERT_TRUE(std::getline(file, line));
+        EXPECT_EQ(line, "before replacement");
+    }
+    
+#ifdef __linux__
+    auto canonical = std::filesystem::canonical(path);
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/fd")) {
+        std::error_code error;
+        auto target = std::filesystem::read_symlink(entry.path(), error);
+        EXPECT_NE(target, canonical) << "replaced default logger still holds its file open";
+    }
+#endif
+    
+    first.reset();
+    std::filesystem::remove_all(dir);
+}
+
+TEST(LoggerManagerTest, StaleDefaultReferenceLogsWhileDefaultIsReplaced) {
+    auto first = std::make_shared<Logger>("stale");
+    first->EnableConsoleOutput(false);
+    first->EnableAsync();
+    LoggerManager::SetDefaultLogger(first);
+    ILogger& stale = LoggerManager::GetDefaultLoggerRef();
+
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> logged{0};
+    std::thread writer([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            stale.Log(LogLevel::INFO, "through a stale reference");
+            logged.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    while (logged.load() == 0) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 20; ++i) {
+        auto replacement = std::make_shared<Logger>("replacement");
+        replacement->EnableConsoleOutput(false);
+        LoggerManager::SetDefaultLogger(std::move(replacement));
+    }
+    stop = true;
+    writer.join();
+    LoggerManager::SetDefaultLogger(nullptr);
+
+    // The retired logger keeps its worker for the stale reference
+    EXPECT_TRUE(first->IsAsync());
+    stale.Flush();
+    EXPECT_EQ(first->GetDroppedCount(), 0u);
+}
+
+TEST(LoggerManagerTest, ParseAndFormatLevels) {
+    EXPECT_EQ(LoggerManager::ParseLogLevel("warning"), LogLevel::WARN);
+    EXPECT_EQ(LoggerManager::ParseLogLevel("DEBUG"), LogLevel::DEBUG);
+    EXPECT_EQ(LoggerManager::ParseLogLevel("bogus"), LogLevel::INFO);
+    EXPECT_EQ(LoggerManager::LogLevelToString(LogLevel::ERROR), "ERROR");
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/FileWriter.hpp>
+#include <vision-infra/core/MemoryAccounting.hpp>
+#include <vision-infra/utils/TensorBufferPool.hpp>
+#include <filesystem>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace vision_infra;
+using core::MemoryAccounting;
+using core::MemoryCharge;
+using core::MemoryTag;
+
+// Accounting is process-wide, so tests compare against the counters at SetUp
+class MemoryAccountingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        MemoryAccounting::SetEnabled(true);
+        MemoryAccounting::ResetPeaks();
+        before_ = MemoryAccounting::GetAllStats();
+    }
+
+    void TearDown() override {
+        MemoryAccounting::SetEnabled(false);
+    }
+
+    core::MemoryTagStats Delta(MemoryTag tag) const {
+        auto now = MemoryAccounting::GetStats(tag);
+        const auto& then = before_[static_cast<size_t>(tag)];
+        core::MemoryTagStats delta;
+        delta.live_bytes = now.live_bytes - then.live_bytes;
+        delta.peak_bytes = now.peak_bytes - then.live_bytes;
+        delta.allocations = now.allocations - then.allocations;
+        delta.frees = now.frees - then.frees;
+        return delta;
+    }
+
+    std::array<core::MemoryTagStats, core::kMemoryTagCount> before_;
+};
+
+TEST_F(MemoryAccountingTest, ChargesTrackLiveAndPeakBytes) {
+    {
+        MemoryCharge charge(MemoryTag::OTHER);
+        EXPECT_TRUE(charge.IsActive());
+        charge.Allocate(1000);
+        charge.Allocate(500);
+        charge.Free(1000);
+        charge.Allocate(0);  // Ignored
+        EXPECT_EQ(charge.Bytes(), 500u);
+
+        auto delta = Delta(MemoryTag::OTHER);
+        EXPECT_EQ(delta.live_bytes, 500u);
+        EXPECT_EQ(delta.peak_bytes, 1500u);
+        EXPECT_EQ(delta.allocations, 2u);
+        EXPECT_EQ(delta.frees, 1u);
+
+        MemoryCharge moved = std::move(charge);
+        EXPECT_FALSE(charge.IsActive());
+        EXPECT_EQ(moved.Bytes(), 500u);
+        moved.Allocate(200);
+        moved.Allocate(300);
+    }
+    // Destruction frees whatever is left, one free per live allocation
+    auto delta = Delta(MemoryTag::OTHER);
+    EXPECT_EQ(delta.live_bytes, 0u);
+    EXPECT_EQ(delta.allocations, 4u);
+    EXPECT_EQ(delta.frees, 4u);
+
+    MemoryAccounting::ResetPeaks();
+    EXPECT_EQ(MemoryAccounting::GetStats(MemoryTag::OTHER).peak_bytes,
+              MemoryAccounting::GetStats(MemoryTag::OTHER).live_bytes);
+}
+
+TEST_F(MemoryAccountingTest, ChargesMadeWhileDisabledStayInert) {
+    MemoryAccounting::SetEnabled(false);
+    MemoryCharge charge(MemoryTag::OTHER);
+    MemoryAccounting::SetEnabled(true);
+
+    EXPECT_FALSE(charge.IsActive());
+    charge.Allocate(4096);
+    charge.Free(4096);
+    EXPECT_EQ(Delta(MemoryTag::OTHER).allocations, 0u);
+    EXPECT_EQ(Delta(MemoryTag::OTHER).frees, 0u);
+}
+
+TEST_F(MemoryAccountingTest, ConcurrentChargesBalance) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            MemoryCharge charge(MemoryTag::OTHER);
+            for (int i = 0; i < 10000; ++i) {
+                charge.Allocate(64);
+                charge.Free(64);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto delta = Delta(MemoryTag::OTHER);
+    EXPECT_EQ(delta.live_bytes, 0u);
+    EXPECT_EQ(delta.allocations, 40000u);
+    EXPECT_EQ(delta.frees, 40000u);
+    EXPECT_GE(delta.peak_bytes, 64u);
+    EXPECT_LE(delta.peak_bytes, 4u * 64);
+}
+
+TEST_F(MemoryAccountingTest, FileWriterBufferIsChargedToIo) {
+    auto path = std::filesystem::temp_directory_path() / "vision_infra_memory_accounting.bin";
+    core::FileWriteOptions options;
+    options.buffer_size = 64 * 1024;
+    {
+        auto writer = core::FileWriter::Open(path.string(), options);
+        ASSERT_TRUE(writer.has_value());
+        EXPECT_EQ(Delta(MemoryTag::IO).live_bytes, 64u * 1024);
+
+        auto moved = std::move(*writer);
+        EXPECT_EQ(Delta(MemoryTag::IO).live_bytes, 64u * 1024);
+    }
+    EXPECT_EQ(Delta(MemoryTag::IO).live_bytes, 0u);
+    EXPECT_EQ(Delta(MemoryTag::IO).frees, 1u);
+    std::filesystem::remove(path);
+}
+
+TEST_F(MemoryAccountingTest, TensorBufferPoolIsChargedForOwnedBuffers) {
+    {
+        utils::TensorBufferPool pool;
+        {
+            auto first = pool.Acquire(3000);
+            auto second = pool.Acquire(100);
+            EXPECT_EQ(Delta(MemoryTag::PREPROCESSING).live_bytes, 4096u + 256u);
+        }
+        // Idle buffers still belong to the pool
+        EXPECT_EQ(Delta(MemoryTag::PREPROCESSING).live_bytes, 4096u + 256u);
+        pool.Trim();
+        EXPECT_EQ(Delta(MemoryTag::PREPROCESSING).live_bytes, 0u);
+        EXPECT_EQ(Delta(MemoryTag::PREPROCESSING).frees, 2u);
+
+        auto third = pool.Acquire(100);
+    }
+    auto delta = Delta(MemoryTag::PREPROCESSING);
+    EXPECT_EQ(delta.live_bytes, 0u);
+    EXPECT_EQ(delta.peak_bytes, 4096u + 256u);
+    EXPECT_EQ(delta.allocations, 3u);
+
+    auto report = utils::MemoryUtils::FormatAccountingReport();
+    EXPECT_NE(report.find("preprocessing: live"), std::string::npos);
+    MemoryAccounting::SetEnabled(false);
+    EXPECT_TRUE(utils::MemoryUtils::FormatAccountingReport().empty());
+}
@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/Profiler.hpp>
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <latch>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace vision_infra::core;
+
+// The profiler is process-wide: every test starts from empty statistics
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Profiler::Reset();
+        Profiler::SetEnabled(true);
+    }
+
+    void TearDown() override {
+        Profiler::StopCapture();
+        Profiler::SetEnabled(false);
+        Profiler::Reset();
+    }
+
+    static const ProfileZoneStats* Find(const std::vector<ProfileZoneStats>& stats, const std::string& name,
+                                        uint32_t thread_index = ProfileZoneStats::kAllThreads) {
+        for (const auto& zone : stats) {
+            if (zone.name == name && zone.thread_index == thread_index) {
+                return &zone;
+            }
+        }
+        return nullptr;
+    }
+
+    static void Spin(std::chrono::microseconds duration) {
+        auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+        }
+    }
+};
+
+TEST_F(ProfilerTest, ZonesRegisterOncePerName) {
+    EXPECT_EQ(Profiler::RegisterZone("test.same"), Profiler::RegisterZone("test.same"));
+    EXPECT_NE(Profiler::RegisterZone("test.same"), Profiler::RegisterZone("test.other"));
+}
+
+TEST_F(ProfilerTest, ScopedZonesAreTimed) {
+    for (int i = 0; i < 20; ++i) {
+        PROFILE_ZONE("test.outer");
+        Spin(std::chrono::microseconds(i < 19 ? 200 : 2000));
+        {
+            PROFILE_ZONE("test.inner");
+            Spin(std::chrono::microseconds(100));
+        }
+    }
+
+    auto stats = Profiler::GetStats();
+    const auto* outer = Find(stats, "test.outer");
+    const auto* inner = Find(stats, "test.inner");
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+    EXPECT_EQ(outer->count, 20u);
+    EXPECT_EQ(inner->count, 20u);
+
+    EXPECT_GE(outer->min_ms, 0.28);
+    EXPECT_GE(outer->max_ms, 2.0);
+    EXPECT_GE(outer->total_ms, inner->total_ms + 19 * 0.2);
+    EXPECT_LE(outer->min_ms, outer->p50_ms);
+    EXPECT_LE(outer->p50_ms, outer->p90_ms);
+    EXPECT_LE(outer->p99_ms, outer->max_ms);
+    EXPECT_LT(outer->p90_ms, 1.0);   // The slow iteration is above p90
+    EXPECT_GE(outer->p99_ms, 1.75);  // ...and at p99, within the 1/8 bucket width
+    EXPECT_NEAR(outer->GetMeanMs(), outer->total_ms / 20, 1e-9);
+
+    // Sorted by total time
+    EXPECT_EQ(stats.front().name, "test.outer");
+}
+
+TEST_F(ProfilerTest, DisabledZonesAreNotRecorded) {
+    Profiler::SetEnabled(false);
+    for (int i = 0; i < 10; ++i) {
+        PROFILE_ZONE("test.disabled");
+    }
+    Profiler::SetEnabled(true);
+    EXPECT_EQ(Find(Profiler::GetStats(), "test.disabled"), nullptr);
+}
+
+TEST_F(ProfilerTest, AggregatesPerThread) {
+    std::latch recorded(3);
+    std::latch collected(1);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([t, &recorded, &collected] {
+            Profiler::SetThreadName("worker " + std::to_string(t));
+            for (int i = 0; i <= t; ++i) {
+                PROFILE_ZONE("test.worker");
+            }
+            recorded.count_down();
+            collected.wait();
+        });
+    }
+    recorded.wait();
+
+    auto per_thread = Profiler::GetStats(true);
+    uint64_t total = 0;
+    size_t threads_seen = 0;
+    for (const auto& zone : per_thread) {
+        if (zone.name == "test.worker") {
+            EXPECT_NE(zone.thread_index, ProfileZoneStats::kAllThreads);
+            auto name = Profiler::GetThreadName(zone.thread_index);
+            EXPECT_EQ(name, "worker " + std::to_string(zone.count - 1));
+            total += zone.count;
+            ++threads_seen;
+        }
+    }
+    EXPECT_EQ(total, 6u);
+    EXPECT_EQ(threads_seen, 3u);
+
+    auto report = Profiler::FormatReport(true);
+    EXPECT_NE(report.find("test.worker"), std::string::npos);
+    EXPECT_NE(report.find("worker 2"), std::string::npos);
+
+    collected.count_down();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Exited threads are folded into one bucket per zone
+    auto stats = Profiler::GetStats();
+    const auto* merged = Find(stats, "test.worker");
+    ASSERT_NE(merged, nullptr);
+    EXPECT_EQ(merged->count, 6u);
+
+    per_thread = Profiler::GetStats(true);
+    const auto* retired = Find(per_thread, "test.worker", ProfileZoneStats::kRetiredThreads);
+    ASSERT_NE(retired, nullptr);
+    EXPECT_EQ(retired->count, 6u);
+    for (const auto& zone : per_thread) {
+        if (zone.name == "test.worker") {
+            EXPECT_EQ(zone.thread_index, ProfileZoneStats::kRetiredThreads);
+        }
+    }
+    EXPECT_EQ(Profiler::GetThreadName(ProfileZoneStats::kRetiredThreads), "retired threads");
+    EXPECT_NE(Profiler::FormatReport(true).find("retired threads"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, FullRingDropsAndCounts) {
+    for (int i = 0; i < 20000; ++i) {
+        PROFILE_ZONE("test.flood");
+    }
+    EXPECT_EQ(Profiler::GetDroppedCount(), 20000u - 16384u);
+    auto stats = Profiler::GetStats();
+    const auto* flood = Find(stats, "test.flood");
+    ASSERT_NE(flood, nullptr);
+    EXPECT_EQ(flood->count, 16384u);
+
+    Profiler::Reset();
+    EXPECT_EQ(Profiler::GetDroppedCount(), 0u);
+    EXPECT_TRUE(Profiler::GetStats().empty());
+}
+
+TEST_F(ProfilerTest, TickRateIsCalibrated) {
+    double ns_per_tick = Profiler::GetNanosecondsPerTick();
+    if (!Profiler::UsesTsc()) {
+        EXPECT_EQ(ns_per_tick, 1.0);
+        return;
+    }
+    // Any TSC between 100 MHz and 10 GHz
+    EXPECT_GT(ns_per_tick, 0.1);
+    EXPECT_LT(ns_per_tick, 10.0);
+
+    uint64_t start = Profiler::Now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    double elapsed_ms = static_cast<double>(Profiler::Now() - start) * Profiler::GetNanosecondsPerTick() / 1e6;
+    EXPECT_GE(elapsed_ms, 19.0);
+    EXPECT_LT(elapsed_ms, 200.0);
+}
+
+static size_t CountOccurrences(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+TEST_F(ProfilerTest, CaptureExportsNestedZonesAsChromeTrace) {
+    Profiler::SetEnabled(false);
+    {
+        PROFILE_ZONE("test.before_capture");
+    }
+
+    ProfileCaptureOptions options;
+    options.duration = std::chrono::milliseconds(0);
+    ASSERT_TRUE(Profiler::StartCapture(options));
+    EXPECT_TRUE(Profiler::IsEnabled());
+    EXPECT_FALSE(Profiler::StartCapture(options));
+
+    std::thread worker([] {
+        Profiler::SetThreadName("decode \"main\"");
+        PROFILE_ZONE("test.decode");
+        Spin(std::chrono::microseconds(200));
+    });
+    worker.join();
+    {
+        PROFILE_ZONE("test.frame");
+        Spin(std::chrono::microseconds(100));
+        {
+            PROFILE_ZONE("test.preprocess");
+            Spin(std::chrono::microseconds(100));
+        }
+    }
+    Profiler::StopCapture();
+    EXPECT_FALSE(Profiler::IsCapturing());
+    EXPECT_FALSE(Profiler::IsEnabled());  // Restored once the capture ended
+
+    auto trace = Profiler::FormatChromeTrace();
+    EXPECT_EQ(trace.front(), '{');
+    EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_EQ(trace.find("test.before_capture"), std::string::npos);
+    EXPECT_EQ(CountOccurrences(trace, "\"ph\":\"X\""), 3u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"thread_name\""), 2u);
+    EXPECT_NE(trace.find("\"decode \\\"main\\\"\""), std::string::npos);  // Escaped thread name
+
+    // The enclosing zone is emitted before the zone nested in it
+    auto frame = trace.find("\"test.frame\"");
+    auto preprocess = trace.find("\"test.preprocess\"");
+    ASSERT_NE(frame, std::string::npos);
+    ASSERT_NE(preprocess, std::string::npos);
+    EXPECT_LT(frame, preprocess);
+
+    auto path = std::filesystem::temp_directory_path() / "vision_infra_profiler_trace.json";
+    ASSERT_TRUE(Profiler::WriteChromeTrace(path.string()));
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), trace);
+    std::filesystem::remove(path);
+}
+
+TEST_F(ProfilerTest, CaptureIsBoundedByDurationAndEvents) {
+    ProfileCaptureOptions options;
+    options.duration = std::chrono::milliseconds(50);
+    options.max_events = 100;
+    ASSERT_TRUE(Profiler::StartCapture(options));
+    for (int i = 0; i < 1000; ++i) {
+        PROFILE_ZONE("test.bounded");
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (Profiler::IsCapturing() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_FALSE(Profiler::IsCapturing());
+    EXPECT_TRUE(Profiler::IsEnabled());  // Was already enabled
+
+    auto trace = Profiler::FormatChromeTrace();
+    EXPECT_EQ(CountOccurrences(trace, "\"ph\":\"X\""), 100u);
+    EXPECT_NE(trace.find("\"dropped_zones\":\"900\""), std::string::npos);
+
+    // Statistics still see every zone
+    auto stats = Profiler::GetStats();
+    const auto* bounded = Find(stats, "test.bounded");
+    ASSERT_NE(bounded, nullptr);
+    EXPECT_EQ(bounded->count, 1000u);
+}
+
+#ifndef _WIN32
+TEST_F(ProfilerTest, SignalTriggersCaptureToFile) {
+    auto path = std::filesystem::temp_directory_path() / "vision_infra_profiler_signal.json";
+    std::filesystem::remove(path);
+    ProfileCaptureOptions options;
+    options.duration = std::chrono::milliseconds(50);
+    ASSERT_TRUE(Profiler::InstallCaptureSignal(SIGUSR2, path.string(), options));
+
+    std::raise(SIGUSR2);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!std::filesystem::exists(path) && std::chrono::steady_clock::now() < deadline) {
+        PROFILE_ZONE("test.signal");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(std::filesystem::exists(path));
+
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_NE(contents.str().find("\"test.signal\""), std::string::npos);
+    std::filesystem::remove(path);
+    std::signal(SIGUSR2, SIG_DFL);
+}
+#endif
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/RotatingFileSink.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace vision_infra::core;
+
+class RotatingFileSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        temp_dir_ = std::filesystem::temp_directory_path() / "vision_infra_sink_test";
+        std::filesystem::remove_all(temp_dir_);
+        std::filesystem::create_directories(temp_dir_);
+        path_ = (temp_dir_ / "app.log").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir_);
+    }
+
+    static std::string ReadAll(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path temp_dir_;
+    std::string path_;
+};
+
+TEST_F(RotatingFileSinkTest, BuffersUntilFlushLevelOrFlush) {
+    FileSinkOptions options;
+    options.flush_interval = std::chrono::hours(1);
+    RotatingFileSink sink(path_, options);
+
+    sink.Write("info line\n", LogLevel::INFO);
+    EXPECT_EQ(ReadAll(path_), "");
+    EXPECT_EQ(sink.GetFileSize(), 10u);
+
+    sink.Write("warn line\n", LogLevel::WARN);
+    EXPECT_EQ(ReadAll(path_), "info line\nwarn line\n");
+
+    sink.Write("debug line\n", LogLevel::DEBUG);
+    sink.Flush();
+    EXPECT_EQ(ReadAll(path_), "info line\nwarn line\ndebug line\n");
+}
+
+TEST_F(RotatingFileSinkTest, FlushIfDueWritesLinesOlderThanFlushInterval) {
+    FileSinkOptions options;
+    options.flush_interval = std::chrono::milliseconds(50);
+    RotatingFileSink sink(path_, options);
+    EXPECT_FALSE(sink.GetFlushDeadline().has_value());
+
+    sink.Write("info line\n", LogLevel::INFO);
+    ASSERT_TRUE(sink.GetFlushDeadline().has_value());
+    sink.FlushIfDue();
+    EXPECT_EQ(ReadAll(path_), "");
+
+    std::this_thread::sleep_until(*sink.GetFlushDeadline());
+    sink.FlushIfDue();
+    EXPECT_EQ(ReadAll(path_), "info line\n");
+    EXPECT_FALSE(sink.GetFlushDeadline().has_value());
+}
+
+TEST_F(RotatingFileSinkTest, RotatesBySizeAndKeepsMaxFiles) {
+    FileSinkOptions options;
+    options.max_file_size = 22;
+    options.max_files = 2;
+    {
+        RotatingFileSink sink(path_, options);
+        for (int i = 0; i < 8; ++i) {
+            sink.Write("line " + std::to_string(i) + " ...\n", LogLevel::INFO);  // 11 bytes
+        }
+    }
+
+    EXPECT_EQ(ReadAll(path_), "line 6 ...\nline 7 ...\n");
+    EXPECT_EQ(ReadAll(RotatingFileSink::RotatedPath(path_, 1)), "line 4 ...\nline 5 ...\n");
+    EXPECT_EQ(ReadAll(RotatingFileSink::RotatedPath(path_, 2)), "line 2 ...\nline 3 ...\n");
+    EXPECT_FALSE(std::filesystem::exists(RotatingFileSink::RotatedPath(path_, 3)));
+}
+
+TEST_F(RotatingFileSinkTest, RotatedPathInsertsIndexBeforeExtension) {
+    EXPECT_EQ(RotatingFileSink::RotatedPath("logs/app.log", 3),
+              (std::filesystem::path("logs") / "app.3.log").string());
+    EXPECT_EQ(RotatingFileSink::RotatedPath("app", 1), "app.1");
+}
+
+TEST_F(RotatingFileSinkTest, FailedRotationKeepsWritingToOldFile) {
+    auto logs = temp_dir_ / "logs";
+    auto moved = temp_dir_ / "moved";
+    std::filesystem::create_directories(logs);
+    auto path = (logs / "app.log").string();
+
+    FileSinkOptions options;
+    options.max_file_size = 22;
+    options.flush_level = LogLevel::TRACE;
+    RotatingFileSink sink(path, options);
+    sink.Write("line 0 ...\n", LogLevel::INFO);
+    sink.Write("line 1 ...\n", LogLevel::INFO);
+
+    // The open file moves along with its directory; the new one cannot be created
+    std::filesystem::rename(logs, moved);
+    EXPECT_NO_THROW(sink.Write("line 2 ...\n", LogLevel::INFO));
+    EXPECT_NO_THROW(sink.Write("line 3 ...\n", LogLevel::INFO));
+    EXPECT_FALSE(sink.GetLastError().empty());
+    EXPECT_EQ(ReadAll((moved / "app.log").string()), "line 0 ...\nline 1 ...\nline 2 ...\nline 3 ...\n");
+
+    // Retried once another max_file_size bytes were written
+    std::filesystem::create_directories(logs);
+    sink.Write("line 4 ...\n", LogLevel::INFO);
+    EXPECT_EQ(ReadAll(path), "line 4 ...\n");
+}
+
+TEST_F(RotatingFileSinkTest, ThrowsWhenFileCannotBeOpened) {
+    EXPECT_THROW(RotatingFileSink((temp_dir_ / "missing" / "app.log").string()), std::runtime_error);
+}
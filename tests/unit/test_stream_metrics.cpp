@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/StreamMetrics.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vision_infra::core;
+using namespace std::chrono_literals;
+
+TEST(StreamMetricsTest, RegistrationIsIdempotentAndBounded) {
+    StreamMetricsOptions options;
+    options.max_streams = 2;
+    StreamMetrics metrics(options);
+
+    auto front = metrics.RegisterStream("camera/front");
+    auto back = metrics.RegisterStream("camera/back");
+    EXPECT_NE(front, back);
+    EXPECT_EQ(metrics.RegisterStream("camera/front"), front);
+    EXPECT_EQ(metrics.GetStreamCount(), 2u);
+    EXPECT_THROW(metrics.RegisterStream("camera/side"), std::runtime_error);
+
+    // Unknown ids are ignored
+    metrics.RecordFrame(7);
+    metrics.RecordDrop(7);
+    EXPECT_EQ(metrics.Snapshot().total_frames, 0u);
+}
+
+TEST(StreamMetricsTest, SnapshotReportsFramesRatesAndLatency) {
+    StreamMetrics metrics;
+    auto id = metrics.RegisterStream("camera/0");
+    for (int i = 0; i < 10; ++i) {
+        metrics.RecordFrame(id, std::chrono::milliseconds(10 + i));
+    }
+    metrics.RecordDrop(id);
+    std::this_thread::sleep_for(20ms);
+
+    auto snapshot = metrics.Snapshot();
+    ASSERT_EQ(snapshot.streams.size(), 1u);
+    const auto& stream = snapshot.streams[0];
+    EXPECT_EQ(stream.name, "camera/0");
+    EXPECT_EQ(stream.frames, 10u);
+    EXPECT_EQ(stream.dropped, 1u);
+    EXPECT_GT(stream.fps, 0.0);
+    EXPECT_LT(stream.fps, 10.0 / 0.02 + 1e-9);  // At least 20 ms since registration
+    EXPECT_DOUBLE_EQ(stream.fps, snapshot.total_fps);
+    EXPECT_GE(stream.ms_since_last_frame, 20.0);
+    EXPECT_FALSE(stream.stalled);
+
+    EXPECT_EQ(stream.latency.count, 10u);
+    EXPECT_DOUBLE_EQ(stream.latency.min_ms, 10.0);
+    EXPECT_DOUBLE_EQ(stream.latency.max_ms, 19.0);
+    EXPECT_EQ(snapshot.latency.count, 10u);
+
+    // The next rate only covers frames since this snapshot
+    auto quiet = metrics.Snapshot(false);
+    EXPECT_EQ(quiet.streams[0].fps, 0.0);
+    EXPECT_GT(quiet.streams[0].average_fps, 0.0);
+    EXPECT_EQ(quiet.streams[0].latency.count, 0u);
+
+    metrics.ResetLatency();
+    EXPECT_EQ(metrics.Snapshot().latency.count, 0u);
+}
+
+TEST(StreamMetricsTest, StalledStreamsComeFirst) {
+    StreamMetricsOptions options;
+    options.stall_timeout = 30ms;
+    StreamMetrics metrics(options);
+    auto stalled = metrics.RegisterStream("stalled");
+    auto slow = metrics.RegisterStream("slow");
+    auto fast = metrics.RegisterStream("fast");
+
+    metrics.RecordFrame(stalled);
+    std::this_thread::sleep_for(50ms);
+    metrics.RecordFrame(slow);
+    for (int i = 0; i < 5; ++i) {
+        metrics.RecordFrame(fast);
+    }
+
+    auto snapshot = metrics.Snapshot();
+    EXPECT_EQ(snapshot.stalled_streams, 1u);
+    EXPECT_TRUE(snapshot.streams[stalled].stalled);
+
+    auto slowest = snapshot.GetSlowest(2);
+    ASSERT_EQ(slowest.size(), 2u);
+    EXPECT_EQ(slowest[0].name, "stalled");
+    EXPECT_EQ(slowest[1].name, "slow");
+    EXPECT_EQ(snapshot.GetSlowest(10).size(), 3u);
+
+    auto report = StreamMetrics::FormatSnapshot(snapshot, 2);
+    EXPECT_NE(report.find("stalled: 1"), std::string::npos);
+    EXPECT_NE(report.find("STALLED"), std::string::npos);
+    EXPECT_EQ(report.find("fast"), std::string::npos);
+}
+
+TEST(StreamMetricsTest, ConcurrentRecordersAcrossStreams) {
+    StreamMetrics metrics;
+    std::vector<StreamMetrics::StreamId> ids;
+    for (int i = 0; i < 200; ++i) {
+        ids.push_back(metrics.RegisterStream("camera/" + std::to_string(i)));
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&metrics, &ids] {
+            for (int frame = 0; frame < 100; ++frame) {
+                for (auto id : ids) {
+                    metrics.RecordFrame(id, std::chrono::microseconds(500 + frame));
+                }
+            }
+        });
+    }
+    // Snapshots run alongside the recorders
+    for (int i = 0; i < 5; ++i) {
+        metrics.Snapshot();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto snapshot = metrics.Snapshot();
+    EXPECT_EQ(snapshot.streams.size(), 200u);
+    EXPECT_EQ(snapshot.total_frames, 200u * 8 * 100);
+    EXPECT_EQ(snapshot.latency.count, 200u * 8 * 100);
+    for (const auto& stream : snapshot.streams) {
+        EXPECT_EQ(stream.frames, 800u);
+    }
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include <vision-infra/utils/TensorBufferPool.hpp>
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace vision_infra::utils;
+
+class TensorBufferPoolTest : public ::testing::Test {
+protected:
+    static bool IsAligned(const void* data, size_t alignment) {
+        return reinterpret_cast<uintptr_t>(data) % alignment == 0;
+    }
+};
+
+TEST_F(TensorBufferPoolTest, SizeClassesArePowersOfTwo) {
+    EXPECT_EQ(TensorBufferPool::GetSizeClass(1), 256u);
+    EXPECT_EQ(TensorBufferPool::GetSizeClass(256), 256u);
+    EXPECT_EQ(TensorBufferPool::GetSizeClass(257), 512u);
+    EXPECT_EQ(TensorBufferPool::GetSizeClass(3 * 640 * 640 * sizeof(float)), 8u * 1024 * 1024);
+}
+
+TEST_F(TensorBufferPoolTest, SteadyStateReusesBuffers) {
+    TensorBufferPool pool;
+    const std::vector<int64_t> shape = {1, 3, 224, 224};
+
+    for (int frame = 0; frame < 10; ++frame) {
+        auto input = pool.Acquire(shape, sizeof(float));
+        auto output = pool.Acquire(1000 * sizeof(float));
+        ASSERT_EQ(input.As<float>().size(), 3u * 224 * 224);
+        EXPECT_TRUE(IsAligned(input.Data(), 64));
+        EXPECT_TRUE(IsAligned(output.Data(), 64));
+        input.As<float>().back() = 1.0f;
+    }
+
+    auto stats = pool.GetStats();
+    EXPECT_EQ(stats.acquires, 20u);
+    EXPECT_EQ(stats.allocations, 2u);
+    EXPECT_EQ(stats.reuses, 18u);
+    EXPECT_DOUBLE_EQ(stats.GetReuseRate(), 0.9);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+    EXPECT_EQ(stats.bytes_cached, TensorBufferPool::GetSizeClass(3 * 224 * 224 * 4) + 4096);
+
+    pool.Trim();
+    EXPECT_EQ(pool.GetStats().bytes_cached, 0u);
+    auto again = pool.Acquire(4000);
+    EXPECT_EQ(pool.GetStats().allocations, 3u);
+}
+
+TEST_F(TensorBufferPoolTest, MovedBuffersReturnOnce) {
+    TensorBufferPool pool;
+    auto first = pool.Acquire(100);
+    void* data = first.Data();
+    EXPECT_EQ(first.Size(), 100u);
+    EXPECT_EQ(first.Capacity(), 256u);
+
+    TensorBuffer second = std::move(first);
+    EXPECT_TRUE(first.Empty());
+    EXPECT_EQ(second.Data(), data);
+    EXPECT_EQ(pool.GetStats().bytes_in_use, 256u);
+
+    second.Release();
+    EXPECT_TRUE(second.Empty());
+    EXPECT_EQ(pool.GetStats().bytes_in_use, 0u);
+    EXPECT_EQ(pool.GetStats().bytes_cached, 256u);
+
+    // Most recently released buffer comes back first
+    EXPECT_EQ(pool.Acquire(200).Data(), data);
+    EXPECT_TRUE(pool.Acquire(0).Empty());
+}
+
+TEST_F(TensorBufferPoolTest, OptionsAreHonoured) {
+    TensorBufferPoolOptions options;
+    options.alignment = 4096;
+    options.max_cached_bytes = 1024;
+    options.use_huge_pages = true;
+    TensorBufferPool pool(options);
+
+    {
+        auto small = pool.Acquire(1000);
+        auto large = pool.Acquire(4 * 1024 * 1024);
+        EXPECT_TRUE(IsAligned(small.Data(), 4096));
+        EXPECT_TRUE(IsAligned(large.Data(), 4096));
+#ifdef __linux__
+        EXPECT_TRUE(IsAligned(large.Data(), 2 * 1024 * 1024));  // Whole huge pages
+#endif
+        large.As<uint8_t>()[large.Size() - 1] = 1;
+    }
+    // Only the small buffer fits the cache budget
+    EXPECT_EQ(pool.GetStats().bytes_cached, 1024u);
+
+    options.alignment = 48;
+    EXPECT_THROW(TensorBufferPool{options}, std::invalid_argument);
+}
+
+TEST_F(TensorBufferPoolTest, ConcurrentAcquireRelease) {
+    TensorBufferPool pool;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool, t] {
+            for (int i = 0; i < 1000; ++i) {
+                auto buffer = pool.Acquire(static_cast<size_t>(1024 * (1 + (i + t) % 4)));
+                buffer.As<uint8_t>()[0] = static_cast<uint8_t>(i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = pool.GetStats();
+    EXPECT_EQ(stats.acquires, 4000u);
+    EXPECT_EQ(stats.reuses + stats.allocations, 4000u);
+    EXPECT_LE(stats.allocations, 16u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+TEST_F(TensorBufferPoolTest, AsMatViewsPooledMemory) {
+    TensorBufferPool pool;
+    auto buffer = pool.Acquire(64 * 48 * 3);
+    cv::Mat view = buffer.AsMat(48, 64, CV_8UC3);
+    EXPECT_EQ(view.data, buffer.Data());
+    EXPECT_EQ(view.rows, 48);
+    EXPECT_EQ(view.type(), CV_8UC3);
+
+    EXPECT_THROW(buffer.AsMat(48, 64, CV_32FC3), std::invalid_argument);
+    EXPECT_THROW(buffer.AsMat(-1, 64, CV_8UC3), std::invalid_argument);
+}
+
+TEST_F(TensorBufferPoolTest, ImageUtilsWriteIntoPooledOutputs) {
+    cv::Mat image(30, 40, CV_8UC3);
+    for (int y = 0; y < image.rows; ++y) {
+        for (int x = 0; x < image.cols; ++x) {
+            image.at<cv::Vec3b>(y, x) = cv::Vec3b(static_cast<uchar>(x), static_cast<uchar>(y), 200);
+        }
+    }
+
+    TensorBufferPool pool;
+    auto resized_buffer = pool.Acquire(32 * 32 * 3);
+    auto normalized_buffer = pool.Acquire(32 * 32 * 3 * sizeof(float));
+    auto chw_buffer = pool.Acquire(32 * 32 * 3 * sizeof(float));
+    cv::Mat resized = resized_buffer.AsMat(32, 32, CV_8UC3);
+    cv::Mat normalized = normalized_buffer.AsMat(32, 32, CV_32FC3);
+    cv::Mat chw = chw_buffer.AsMat({3, 32, 32}, CV_32F);
+
+    const std::vector<float> mean = {0.5f, 0.25f, 0.0f};
+    const std::vector<float> std = {0.5f, 0.25f, 1.0f};
+    ImageUtils::ResizeKeepAspectRatio(image, cv::Size(32, 32), resized);
+    ImageUtils::Normalize(resized, mean, std, normalized);
+    ImageUtils::HwcToChw(normalized, chw);
+
+    // Results landed in the pooled buffers rather than fresh allocations
+    EXPECT_EQ(resized.data, resized_buffer.Data());
+    EXPECT_EQ(normalized.data, normalized_buffer.Data());
+    EXPECT_EQ(chw.data, chw_buffer.Data());
+
+    auto reference = ImageUtils::Normalize(ImageUtils::ResizeKeepAspectRatio(image, cv::Size(32, 32)), mean, std);
+    EXPECT_EQ(cv::norm(reference, normalized, cv::NORM_INF), 0.0);
+
+    const float* planes = chw.ptr<float>();
+    for (int c = 0; c < 3; ++c) {
+        EXPECT_FLOAT_EQ(planes[(c * 32 + 16) * 32 + 16], reference.at<cv::Vec3f>(16, 16)[c]);
+    }
+
+    cv::Mat hwc;
+    ImageUtils::ChwToHwc(chw, hwc);
+    EXPECT_EQ(cv::norm(hwc, normalized, cv::NORM_INF), 0.0);
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include <vision-infra/core/ThreadPool.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace vision_infra::core;
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pool_ = std::make_unique<ThreadPool>(4);
+    }
+    
+    std::unique_ptr<ThreadPool> pool_;
+};
+
+TEST_F(ThreadPoolTest, SubmitReturnsResult) {
+    auto future = pool_->Submit([] { return 21 * 2; });
+    
+    EXPECT_EQ(future.get(), 42);
+    EXPECT_EQ(pool_->GetNumThreads(), 4);
+}
+
+TEST_F(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    std::vector<std::atomic<int>> visits(1000);
+    
+    pool_->ParallelFor(0, visits.size(), [&](size_t i) { visits[i].fetch_add(1); });
+    
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST_F(ThreadPoolTest, ParallelForRethrowsException) {
+    EXPECT_THROW(pool_->ParallelFor(0, 100, [](size_t i) {
+        if (i == 37) throw std::runtime_error("failure");
+    }), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, NestedParallelForCompletes) {
+    std::atomic<int> total{0};
+    
+    pool_->ParallelFor(0, 8, [&](size_t) {
+        pool_->ParallelFor(0, 8, [&](size_t) { total.fetch_add(1); });
+    });
+    
+    EXPECT_EQ(total.load(), 64);
+}
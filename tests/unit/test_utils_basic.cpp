@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <vision-infra/utils/VisionUtils.hpp>
 #include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <thread>
 
 using namespace vision_infra::utils;
 
@@ -187,6 +189,162 @@ TEST_F(ImageUtilsBasicTest, CenterCrop) {
     EXPECT_EQ(cropped.type(), test_image_.type());
 }
 
+TEST_F(ImageUtilsBasicTest, ComputeLetterbox) {
+    auto info = ImageUtils::ComputeLetterbox(cv::Size(1920, 1080), cv::Size(640, 640));
+    
+    EXPECT_FLOAT_EQ(info.scale, 1.0f / 3.0f);
+    EXPECT_EQ(info.resized_size, cv::Size(640, 360));
+    EXPECT_EQ(info.pad_x, 0);
+    EXPECT_EQ(info.pad_y, 140);
+}
+
+TEST_F(ImageUtilsBasicTest, PreprocessToChwMatchesLetterbox) {
+    cv::Mat image(60, 100, CV_8UC3);
+    for (int y = 0; y < image.rows; ++y) {
+        for (int x = 0; x < image.cols; ++x) {
+            image.at<cv::Vec3b>(y, x) = cv::Vec3b(static_cast<uchar>(x * 2), static_cast<uchar>(y * 4),
+                                                  static_cast<uchar>((x + y) % 256));
+        }
+    }
+    
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(64, 64);
+    options.scale = 1.0f;
+    
+    std::vector<float> output(3 * 64 * 64);
+    auto info = ImageUtils::PreprocessToChw(image, options, output);
+    auto reference = ImageUtils::ResizeKeepAspectRatio(image, options.target_size);
+    
+    EXPECT_EQ(info.pad_x, 0);
+    EXPECT_GT(info.pad_y, 0);
+    for (int c = 0; c < 3; ++c) {
+        for (int y = 0; y < 64; ++y) {
+            for (int x = 0; x < 64; ++x) {
+                float expected = reference.at<cv::Vec3b>(y, x)[c];
+                float actual = output[static_cast<size_t>((c * 64 + y) * 64 + x)];
+                ASSERT_NEAR(actual, expected, 1.01f) << "c=" << c << " y=" << y << " x=" << x;
+            }
+        }
+    }
+}
+
+TEST_F(ImageUtilsBasicTest, PreprocessToChwNormalizesAndSwapsChannels) {
+    cv::Mat image(10, 10, CV_8UC3, cv::Scalar(0, 51, 255));
+    
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(10, 10);
+    options.mean = {0.5f, 0.5f, 0.5f};
+    options.std = {0.5f, 0.5f, 0.5f};
+    options.swap_rb = true;
+    
+    std::vector<float> output(3 * 10 * 10);
+    ImageUtils::PreprocessToChw(image, options, output);
+    
+    EXPECT_NEAR(output[0], 1.0f, 1e-5f);      // R plane from source channel 2
+    EXPECT_NEAR(output[100], -0.6f, 1e-5f);   // G plane
+    EXPECT_NEAR(output[200], -1.0f, 1e-5f);   // B plane from source channel 0
+}
+
+TEST_F(ImageUtilsBasicTest, PreprocessToChwAppliesMeanStdInSwappedOrder) {
+    cv::Mat image(10, 10, CV_8UC3, cv::Scalar(0, 51, 255));  // B=0.0, G=0.2, R=1.0 after scaling
+
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(10, 10);
+    options.mean = {0.4f, 0.2f, 0.1f};  // RGB, as with blobFromImage
+    options.std = {0.2f, 0.4f, 0.5f};
+    options.swap_rb = true;
+
+    std::vector<float> output(3 * 10 * 10);
+    ImageUtils::PreprocessToChw(image, options, output);
+
+    EXPECT_NEAR(output[0], 3.0f, 1e-5f);      // (R - mean[0]) / std[0]
+    EXPECT_NEAR(output[100], 0.0f, 1e-5f);    // (G - mean[1]) / std[1]
+    EXPECT_NEAR(output[200], -0.2f, 1e-5f);   // (B - mean[2]) / std[2]
+}
+
+TEST_F(ImageUtilsBasicTest, PreprocessToChwRejectsSmallBuffer) {
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(32, 32);
+    
+    std::vector<float> output(10);
+    EXPECT_THROW(ImageUtils::PreprocessToChw(test_image_, options, output), std::invalid_argument);
+}
+
+TEST_F(ImageUtilsBasicTest, BatchImagesWritesContiguousNchw) {
+    std::vector<cv::Mat> images = {
+        cv::Mat(40, 80, CV_8UC3, cv::Scalar(10, 20, 30)),
+        cv::Mat(80, 40, CV_8UC3, cv::Scalar(200, 100, 50))
+    };
+    
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(32, 32);
+    
+    auto shape = ImageUtils::GetBatchShape(4, 3, options.target_size);
+    EXPECT_EQ(shape, std::vector<int64_t>({4, 3, 32, 32}));
+    
+    std::vector<uint8_t> batch(MemoryUtils::GetTensorMemorySize(shape, sizeof(uint8_t)), 0xFF);
+    auto infos = ImageUtils::BatchImages(images, options, batch);
+    
+    ASSERT_EQ(infos.size(), 2);
+    EXPECT_EQ(infos[0].resized_size, cv::Size(32, 16));
+    EXPECT_EQ(infos[1].resized_size, cv::Size(16, 32));
+    
+    const size_t image_size = 3 * 32 * 32;
+    // Image 0: centre pixel of each plane, then padding row at the top
+    EXPECT_EQ(batch[16 * 32 + 16], 10);
+    EXPECT_EQ(batch[1024 + 16 * 32 + 16], 20);
+    EXPECT_EQ(batch[2048 + 16 * 32 + 16], 30);
+    EXPECT_EQ(batch[0], 114);
+    // Image 1: centre pixel, then padding column on the left
+    EXPECT_EQ(batch[image_size + 16 * 32 + 16], 200);
+    EXPECT_EQ(batch[image_size + 2048 + 16 * 32 + 16], 50);
+    EXPECT_EQ(batch[image_size + 16 * 32], 114);
+    // Unused slots are zeroed
+    EXPECT_TRUE(std::all_of(batch.begin() + 2 * image_size, batch.end(), [](uint8_t v) { return v == 0; }));
+}
+
+TEST_F(ImageUtilsBasicTest, BatchImagesRejectsOverflow) {
+    std::vector<cv::Mat> images(3, test_image_);
+    
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(16, 16);
+    
+    std::vector<float> batch(2 * 3 * 16 * 16);
+    EXPECT_THROW(ImageUtils::BatchImages(images, options, batch), std::invalid_argument);
+}
+
+TEST_F(ImageUtilsBasicTest, ParallelBatchMatchesSerial) {
+    std::vector<cv::Mat> images;
+    for (int i = 0; i < 3; ++i) {
+        cv::Mat image(120 + i * 10, 160, CV_8UC3);
+        for (int y = 0; y < image.rows; ++y) {
+            for (int x = 0; x < image.cols; ++x) {
+                image.at<cv::Vec3b>(y, x) = cv::Vec3b(static_cast<uchar>(x + i), static_cast<uchar>(y),
+                                                      static_cast<uchar>(x ^ y));
+            }
+        }
+        images.push_back(image);
+    }
+    
+    ImageUtils::PreprocessOptions options;
+    options.target_size = cv::Size(96, 96);
+    options.mean = {0.485f, 0.456f, 0.406f};
+    options.std = {0.229f, 0.224f, 0.225f};
+    
+    const size_t batch_size = 3 * 3 * 96 * 96;
+    std::vector<float> serial(batch_size);
+    std::vector<float> parallel(batch_size);
+    
+    vision_infra::core::ThreadPool pool(8);
+    ImageUtils::BatchImages(images, options, serial);
+    ImageUtils::BatchImages(images, options, parallel, pool);
+    EXPECT_EQ(serial, parallel);
+    
+    std::vector<float> single(3 * 96 * 96);
+    ImageUtils::PreprocessToChw(images[1], options, single, pool);
+    EXPECT_TRUE(std::equal(single.begin(), single.end(), serial.begin() + 3 * 96 * 96));
+}
+
 // Test MemoryUtils functionality
 class MemoryUtilsBasicTest : public ::testing::Test {
 protected:
@@ -218,4 +376,107 @@ TEST_F(MemoryUtilsBasicTest, FormatBytes) {
     EXPECT_EQ(MemoryUtils::FormatBytes(1024), "1.00 KB");
     EXPECT_EQ(MemoryUtils::FormatBytes(1024 * 1024), "1.00 MB");
     EXPECT_EQ(MemoryUtils::FormatBytes(1024 * 1024 * 1024), "1.00 GB");
-}
\ No newline at end of file
+}
+#ifdef __linux__
+TEST_F(MemoryUtilsBasicTest, ProcessMemoryInfo) {
+    auto info = MemoryUtils::GetProcessMemoryInfo(true);
+    EXPECT_GT(info.rss, 0u);
+    EXPECT_GE(info.peak_rss, info.rss);
+    EXPECT_GE(info.virtual_size, info.rss);
+    EXPECT_GT(info.pss, 0u);
+
+    EXPECT_GT(MemoryUtils::GetProcessMemoryUsage(), 0u);
+    EXPECT_EQ(MemoryUtils::GetProcessMemoryInfo().pss, 0u);
+}
+
+TEST_F(MemoryUtilsBasicTest, SystemMemoryInfo) {
+    auto info = MemoryUtils::GetSystemMemoryInfo();
+    EXPECT_GT(info.total, 0u);
+    EXPECT_LE(info.available, info.total);
+    EXPECT_LE(info.free, info.total);
+    EXPECT_LE(MemoryUtils::GetSystemMemoryUsage(), info.total);
+}
+
+TEST_F(MemoryUtilsBasicTest, SamplerTracksPeak) {
+    MemoryUtils::Sampler sampler(std::chrono::milliseconds(1));
+    EXPECT_FALSE(sampler.IsRunning());
+
+    sampler.Start();
+    EXPECT_TRUE(sampler.IsRunning());
+    EXPECT_GT(sampler.GetCurrentRss(), 0u);
+
+    // Touch some pages so there is something to see
+    std::vector<char> block(32 * 1024 * 1024, 1);
+    while (sampler.GetSampleCount() < 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    sampler.Stop();
+    EXPECT_FALSE(sampler.IsRunning());
+
+    EXPECT_GE(sampler.GetPeakRss(), sampler.GetCurrentRss());
+    EXPECT_GE(sampler.GetWindowPeakRss(), sampler.GetCurrentRss());
+    EXPECT_LE(sampler.GetWindowPeakRss(), sampler.GetPeakRss());
+    EXPECT_GT(block.back(), 0);
+}
+#endif
+
+// Test PerformanceUtils::FPSCounter functionality
+class FPSCounterBasicTest : public ::testing::Test {
+protected:
+    using Clock = PerformanceUtils::FPSCounter::Clock;
+
+    // Feed frames at the given intervals, starting from a fixed time
+    static void Feed(PerformanceUtils::FPSCounter& counter, const std::vector<std::chrono::microseconds>& intervals) {
+        Clock::time_point timestamp{};
+        counter.Update(timestamp);
+        for (auto interval : intervals) {
+            timestamp += interval;
+            counter.Update(timestamp);
+        }
+    }
+};
+
+TEST_F(FPSCounterBasicTest, SubMillisecondPrecisionAt144Fps) {
+    PerformanceUtils::FPSCounter counter(30);
+    // 6944 us per frame: millisecond truncation would report 166.7 FPS
+    Feed(counter, std::vector<std::chrono::microseconds>(100, std::chrono::microseconds(6944)));
+
+    EXPECT_NEAR(counter.GetInstantFPS(), 144.009, 0.001);
+    EXPECT_NEAR(counter.GetCurrentFPS(), 144.009, 0.001);
+    EXPECT_NEAR(counter.GetAverageFPS(), 144.009, 0.001);
+    EXPECT_NEAR(counter.GetIntervalStdDevMs(), 0.0, 1e-6);
+    EXPECT_EQ(counter.GetFrameCount(), 101u);
+}
+
+TEST_F(FPSCounterBasicTest, WindowAndLifetimeDiverge) {
+    PerformanceUtils::FPSCounter counter(11);
+    // 50 frames at 10 ms, then 10 at 20 ms
+    std::vector<std::chrono::microseconds> intervals(50, std::chrono::milliseconds(10));
+    intervals.insert(intervals.end(), 10, std::chrono::milliseconds(20));
+    Feed(counter, intervals);
+
+    EXPECT_NEAR(counter.GetCurrentFPS(), 50.0, 1e-9);   // The window only holds 20 ms intervals
+    EXPECT_NEAR(counter.GetAverageFPS(), 60.0 / 0.7, 1e-9);
+    EXPECT_NEAR(counter.GetInstantFPS(), 50.0, 1e-9);
+}
+
+TEST_F(FPSCounterBasicTest, JitterAndDeadlineMisses) {
+    PerformanceUtils::FPSCounter counter(5, 20.0);
+    // Window intervals alternate 10 ms / 30 ms: mean 20 ms, stddev 10 ms
+    Feed(counter, {std::chrono::milliseconds(40), std::chrono::milliseconds(10), std::chrono::milliseconds(30),
+                   std::chrono::milliseconds(10), std::chrono::milliseconds(30)});
+
+    EXPECT_NEAR(counter.GetIntervalStdDevMs(), 10.0, 1e-9);
+    EXPECT_EQ(counter.GetDeadlineMissCount(), 3u);  // 40 ms and both 30 ms intervals
+    EXPECT_NEAR(counter.GetCurrentFPS(), 50.0, 1e-9);
+
+    counter.Reset();
+    EXPECT_EQ(counter.GetFrameCount(), 0u);
+    EXPECT_EQ(counter.GetDeadlineMissCount(), 0u);
+    EXPECT_EQ(counter.GetCurrentFPS(), 0.0);
+    EXPECT_EQ(counter.GetAverageFPS(), 0.0);
+}
+
+TEST_F(FPSCounterBasicTest, RejectsWindowWithoutIntervals) {
+    EXPECT_THROW(PerformanceUtils::FPSCounter(1), std::invalid_argument);
+}
@@ -0,0 +1,34 @@
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vision-infra/core/BinaryLogReader.hpp>
+
+using namespace vision_infra::core;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " <binary-log> [pattern]\n"
+                  << "Decodes a BinaryLogSink file into text lines on stdout.\n";
+        return 1;
+    }
+
+    try {
+        BinaryLogReader reader(argv[1]);
+        if (argc == 3) {
+            reader.SetPattern(argv[2]);
+        }
+
+        BinaryLogEntry entry;
+        std::string line;
+        while (reader.Next(entry)) {
+            line.clear();
+            reader.FormatEntry(entry, line);
+            line.push_back('\n');
+            std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}